@@ -8,723 +8,4262 @@
 
 /// C++ Standard Library Header Files
 #include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <charconv>
+#include <compare>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <initializer_list>
 #include <iterator>
 #include <exception>
+#include <limits>
+#include <type_traits>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <ranges>
+#include <sstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
 #include <vector>
+#include <version>
+
+#if defined(__cpp_lib_format)
+#include <format>
+#endif
+
+/// POSIX Header Files
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#endif
 
 namespace AL {
 
-template <class T> class ArrayList {
-    public:
-        struct Iterator {
-        public:
-            // Iterator Type Aliases
-            using iterator_category = std::bidirectional_iterator_tag;
-            using difference_type   = std::ptrdiff_t;
-            using value_type        = T;
-            using reference         = value_type&;
-            using pointer           = value_type*;
-            
-            /// ------------------------------------------------------------------
-            /// @function Iterator   </! Iterator Default Constructor !/>
-            /// @param    ptr         initializes pointer to nullptr
-            /// @note     Initializes instance variables.
-            /// ------------------------------------------------------------------
-            Iterator(pointer ptr = nullptr) : m_ptr(ptr) {}
-            
-            /// ------------------------------------------------------------------
-            /// @function Iterator   </! Copy Constructor !/>
-            /// @param    other    A copy of the other iterator
-            /// @note     Makes a shallow copy.
-            /// ------------------------------------------------------------------
-            
-            Iterator(const Iterator& other) : m_ptr(other.m_ptr) {}
-            
-            /// ------------------------------------------------------------------
-            /// @function operator*  </! Dereference Operator !/>
-            ///
-            /// @return   Returns a reference to the object pointed to by m_ptr.
-            /// ------------------------------------------------------------------
-            
-            reference operator*() const { return *m_ptr; }
-            
-            /// ------------------------------------------------------------------
-            /// @function operator*  </! Member Access Operator !/>
-            ///
-            /// @return   Returns a pointer to the object.
-            /// -----------------------------------------------------------------
-            pointer operator->() { return m_ptr; }
-            
-            /// ------------------------------------------------------------------
-            /// @function operator++  </! Increment Operator !/>
-            ///
-            /// @return Returns incremented reference to the 'Iterator' object.
-            /// ------------------------------------------------------------------
-            
-            Iterator& operator++() { ++m_ptr; return *this; }
-            
-            /// ------------------------------------------------------------------
-            /// @function operator--  </! Decrement Operator !/>
-            ///
-            /// @return Returns decremented reference to the 'Iterator' object.
-            /// ------------------------------------------------------------------
+/// ----------------------------------------------------------------------
+/// @struct   is_trivially_relocatable
+/// @note Tells whether moving a T to a new address and ending the lifetime
+/// of the original can be done by copying its bytes. ArrayList then grows,
+/// inserts and erases with a single memcpy/memmove instead of element by
+/// element. True for trivially copyable types; specialize it for types
+/// that don't hold pointers into themselves, e.g.,
+///
+///     template <> struct AL::is_trivially_relocatable<Handle>
+///     : std::true_type {};
+/// ----------------------------------------------------------------------
 
-            Iterator& operator--() { --m_ptr; return *this; }
-            
-            /// ------------------------------------------------------------------
-            /// @function operator<  </! Less Than Rational Operator !/>
-            ///
-            /// @return True if m_ptr is less than other m_ptr, else false
-            /// ------------------------------------------------------------------
-            
-            bool operator<(const Iterator& other) { return m_ptr < other.m_ptr; }
-            
-            /// ------------------------------------------------------------------
-            /// @function operator>  </! Greater Than Rational Operator !/>
-            ///
-            /// @return True if m_ptr is greater than other m_ptr, else false
-            /// ------------------------------------------------------------------
-            
-            bool operator>(const Iterator& other) { return m_ptr > other.m_ptr; }
+template <class T>
+struct is_trivially_relocatable
+: std::bool_constant<std::is_trivially_copyable_v<T>> {};
 
-            /// ------------------------------------------------------------------
-            /// @function operator==    </! Equality Comparison Operator !/>
-            /// @param    lhs        -Left-hand side dynamic array
-            /// @param    rhs        -Right-hand side dynamic array
-            /// @return   True if lhs 'does' compare equal to rhs, else false.
-            /// ------------------------------------------------------------------
-        
-            friend bool operator==(const Iterator& lhs, const Iterator& rhs) { return lhs.m_ptr == rhs.m_ptr; }
-            
-            /// ------------------------------------------------------------------
-            /// @function operator!=    </! Inequality Comparison Operator !/>
-            /// @param    lhs        -Left-hand side dynamic array
-            /// @param    rhs        -Right-hand side dynamic array
-            /// @return   True if lhs is 'not' equal to rhs, else false.
-            /// ------------------------------------------------------------------
-            
-            friend bool operator!=(const Iterator& lhs, const Iterator& rhs) { return lhs.m_ptr != rhs.m_ptr; }
-            
-            /// ------------------------------------------------------------------
-            
-        private:
-            pointer m_ptr{}; ///< Iterator pointer
-        };  // Iterator class
-    
-    // type aliases
-    using value_type      = T;
-    using size_type       = std::size_t;
-    using reference       = value_type&;
-    using const_reference = const value_type&;
-    using pointer         = value_type*;
-    using const_pointer   = const value_type*;
-    using iterator        = Iterator;
-    using const_iterator  = const iterator;
-    
-    size_type vector_size = 0;
-    
-    /// ----------------------------------------------------------------------
-    /// @function ArrayList </! Default Constructor !/>
-    /// @param count    initializes the count to 0
-    /// @note Default constructor. Constructs an ArrayList with count copies of
-    /// the default value of value_type, e.g., the default value for an
-    /// int is 0.
-    /// ----------------------------------------------------------------------
-    
-    ArrayList(size_type count = 0)
-    : m_capacity(count), m_size(count), m_data(new value_type[count]{}) {}
-    
-    /// ----------------------------------------------------------------------
-    /// @function ArrayList
-    /// @param    source   Holds initializer list of elements
-    /// @note     Constructs a container with a copy of the source elements.
-    /// ----------------------------------------------------------------------
-    ArrayList(const std::initializer_list<value_type>& source);
-    
-    /// ----------------------------------------------------------------------
-    /// @function ArrayList  </! Copy Constructor !/>
-    /// @param    other    holds a reference to other ArrayList
-    /// @note     Makes a deep copy of another ArrayList.
-    /// ----------------------------------------------------------------------
-    
-    ArrayList(const ArrayList& other);
-    
-    /// ----------------------------------------------------------------------
-    /// @function ArrayList  </! Move Constructor !/>
-    /// @param    other     holds the state of another object being moved
-    /// @note Creates container with source contents using move semantics.
-    /// ----------------------------------------------------------------------
-    
-    ArrayList(ArrayList&& other)
-    : m_capacity(std::exchange(other.m_capacity, 0)),
-      m_size(std::exchange(other.m_size, 0)),
-      m_data(std::exchange(other.m_data, nullptr)) {}
+template <class T>
+struct is_trivially_relocatable<std::unique_ptr<T>> : std::true_type {};
+
+template <class T>
+struct is_trivially_relocatable<std::allocator<T>> : std::true_type {};
+
+template <class T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+/// ----------------------------------------------------------------------
+/// @struct   is_trivially_equality_comparable
+/// @note Tells whether two T compare equal exactly when their bytes do, so
+/// ArrayList equality can use memcmp. True for integers, enums and
+/// pointers; specialize it for structs whose operator== is defaulted and
+/// that hold no padding or floating-point members.
+/// ----------------------------------------------------------------------
+
+template <class T>
+struct is_trivially_equality_comparable
+: std::bool_constant<(std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>) &&
+                     std::has_unique_object_representations_v<T>> {};
+
+template <class T>
+inline constexpr bool is_trivially_equality_comparable_v = is_trivially_equality_comparable<T>::value;
+
+//! ************************ Growth Policies ************************* !//
+
+/// ----------------------------------------------------------------------
+/// @struct   GeometricGrowth
+/// @note Growth policy that multiplies the capacity by Numerator/Denominator
+/// whenever the container runs out of room. A GrowthPolicy provides
+///
+///     static std::size_t next_capacity(std::size_t capacity,
+///                                      std::size_t required,
+///                                      std::size_t element_size);
+///
+/// returning the new capacity, which must be at least 'required'.
+/// ----------------------------------------------------------------------
+
+template <std::size_t Numerator, std::size_t Denominator>
+struct GeometricGrowth {
+    static_assert(Numerator > Denominator && Denominator > 0,
+                  "GeometricGrowth must grow the capacity");
     
-    /// ----------------------------------------------------------------------
-    /// @function ~ArrayList  </! Deconstructor !/>
-    ///
-    /// @note Releases any resources the object aquired over its lifetime.
-    /// ----------------------------------------------------------------------
-    virtual ~ArrayList() { delete[] m_data; }
+    static std::size_t next_capacity(std::size_t capacity, std::size_t required,
+                                     std::size_t /* element_size */)
+    {
+        constexpr std::size_t limit = std::numeric_limits<std::size_t>::max() / Numerator;
+        
+        const std::size_t grown = capacity == 0 ? 1
+                                : capacity > limit ? std::numeric_limits<std::size_t>::max()
+                                : capacity * Numerator / Denominator;
+        
+        return std::max(grown, required);
+    }
+};
+
+/// Doubles the capacity, the default GrowthPolicy.
+using DoublingGrowth = GeometricGrowth<2, 1>;
+
+/// Grows the capacity by half, which lets the allocator reuse the blocks
+/// freed by earlier reallocations.
+using ThreeHalvesGrowth = GeometricGrowth<3, 2>;
+
+/// ----------------------------------------------------------------------
+/// @struct   PageRoundedGrowth
+/// @note Growth policy that rounds the capacity picked by BasePolicy up so
+/// the allocation fills whole pages of PageSize bytes. Allocations smaller
+/// than a page are left as BasePolicy sized them.
+/// ----------------------------------------------------------------------
+
+template <std::size_t PageSize = 4096, class BasePolicy = DoublingGrowth>
+struct PageRoundedGrowth {
+    static std::size_t next_capacity(std::size_t capacity, std::size_t required,
+                                     std::size_t element_size)
+    {
+        const std::size_t count = BasePolicy::next_capacity(capacity, required, element_size);
+        
+        // leaves sub-page and overflowing sizes alone
+        if (count >= PageSize / element_size &&
+            count <= (std::numeric_limits<std::size_t>::max() - PageSize) / element_size)
+        {
+            const std::size_t bytes = (count * element_size + PageSize - 1) / PageSize * PageSize;
+            return bytes / element_size;
+        }
+        return count;
+    }
+};
+
+//! ************************* Stats Policies ************************* !//
+
+/// ----------------------------------------------------------------------
+/// @struct   NoStats
+/// @note Default StatsPolicy, every hook is an empty inline function so
+/// instrumentation compiles away. A StatsPolicy provides
+///
+///     static constexpr bool enabled;
+///     static void on_allocate(std::size_t bytes);
+///     static void on_deallocate(std::size_t bytes);
+///     static void on_reallocate(std::size_t old_capacity, std::size_t new_capacity);
+///     static void on_relocate(std::size_t count, bool copied);
+///     static void on_insert_shift(std::size_t count);
+///     static void on_erase_shift(std::size_t count);
+///     static void on_live_size(std::ptrdiff_t bytes);
+///     static void on_live_capacity(std::ptrdiff_t bytes);
+///
+/// Capacities and counts are in elements. The live hooks receive every
+/// change to the bytes held by elements and by capacity, inline storage
+/// included, and are only called when 'enabled' is true. A custom policy,
+/// e.g., one forwarding to a metrics client, can derive from NoStats and
+/// hide the hooks it needs.
+/// ----------------------------------------------------------------------
+
+struct NoStats {
+    static constexpr bool enabled = false;
     
-    /// ----------------------------------------------------------------------
-    /// @function at
-    /// @param    pos     Zero-based index of the element to access
-    /// @return   Returns a reference to an element at the specified position.
-    /// ----------------------------------------------------------------------
+    static void on_allocate(std::size_t /* bytes */) noexcept {}
+    static void on_deallocate(std::size_t /* bytes */) noexcept {}
+    static void on_reallocate(std::size_t /* old_capacity */, std::size_t /* new_capacity */) noexcept {}
+    static void on_relocate(std::size_t /* count */, bool /* copied */) noexcept {}
+    static void on_insert_shift(std::size_t /* count */) noexcept {}
+    static void on_erase_shift(std::size_t /* count */) noexcept {}
+    static void on_live_size(std::ptrdiff_t /* bytes */) noexcept {}
+    static void on_live_capacity(std::ptrdiff_t /* bytes */) noexcept {}
+};
+
+/// ----------------------------------------------------------------------
+/// @struct   StatsSnapshot
+/// @note Plain copy of the counters of a StatsRegistry.
+/// ----------------------------------------------------------------------
+
+struct StatsSnapshot {
+    std::uint64_t reallocations   = 0;  ///< Storage replaced to change capacity.
+    std::uint64_t bytes_allocated = 0;  ///< Heap bytes requested from allocators.
+    std::uint64_t bytes_freed     = 0;  ///< Heap bytes returned to allocators.
+    std::uint64_t peak_capacity   = 0;  ///< Largest capacity reached, in elements.
+    std::uint64_t elements_moved  = 0;  ///< Elements moved, or memcpy'd, into new storage.
+    std::uint64_t elements_copied = 0;  ///< Elements copied into new storage.
+    std::uint64_t insert_shifted  = 0;  ///< Elements shifted right by inserts.
+    std::uint64_t erase_shifted   = 0;  ///< Elements shifted left by erases.
+    std::int64_t  live_bytes      = 0;  ///< Bytes held by live elements.
+    std::int64_t  capacity_bytes  = 0;  ///< Bytes of capacity held by live lists.
     
-    reference at(size_type pos);
-    const_reference at(size_type pos) const;
+    /// Bytes of capacity not holding an element.
+    std::int64_t slack_bytes() const noexcept { return capacity_bytes - live_bytes; }
+};
+
+/// ----------------------------------------------------------------------
+/// @struct   StatsRegistry
+/// @note Process-wide counters updated by CountingStats. Updates are
+/// relaxed atomics, so lists on any thread may report into one registry.
+/// ----------------------------------------------------------------------
+
+struct StatsRegistry {
+    std::atomic<std::uint64_t> reallocations{ 0 };
+    std::atomic<std::uint64_t> bytes_allocated{ 0 };
+    std::atomic<std::uint64_t> bytes_freed{ 0 };
+    std::atomic<std::uint64_t> peak_capacity{ 0 };
+    std::atomic<std::uint64_t> elements_moved{ 0 };
+    std::atomic<std::uint64_t> elements_copied{ 0 };
+    std::atomic<std::uint64_t> insert_shifted{ 0 };
+    std::atomic<std::uint64_t> erase_shifted{ 0 };
+    std::atomic<std::int64_t>  live_bytes{ 0 };
+    std::atomic<std::int64_t>  capacity_bytes{ 0 };
     
     /// ----------------------------------------------------------------------
-    /// @function front
+    /// @function snapshot
     ///
-    /// @return Returns a reference to the first element in the container.
+    /// @return Returns a copy of the counters, for export.
     /// ----------------------------------------------------------------------
     
-    reference front();
-    const_reference front() const;
+    StatsSnapshot snapshot() const noexcept
+    {
+        constexpr auto relaxed = std::memory_order_relaxed;
+        
+        return { reallocations.load(relaxed),  bytes_allocated.load(relaxed),
+                 bytes_freed.load(relaxed),    peak_capacity.load(relaxed),
+                 elements_moved.load(relaxed), elements_copied.load(relaxed),
+                 insert_shifted.load(relaxed), erase_shifted.load(relaxed),
+                 live_bytes.load(relaxed),     capacity_bytes.load(relaxed) };
+    }
     
     /// ----------------------------------------------------------------------
-    /// @function back
+    /// @function reset
     ///
-    /// @return Returns a reference to the last element in the container.
+    /// @note Zeroes the event counters. The live gauges are left alone, as
+    /// they describe lists that still exist.
     /// ----------------------------------------------------------------------
     
-    reference back() { return *(begin() + size() - 1); }
-    const_reference back() const { return *(begin() + size() - 1); }
+    void reset() noexcept
+    {
+        for (auto* counter : { &reallocations, &bytes_allocated, &bytes_freed, &peak_capacity,
+                               &elements_moved, &elements_copied, &insert_shifted, &erase_shifted })
+        {
+            counter->store(0, std::memory_order_relaxed);
+        }
+    }
+};
+
+/// ----------------------------------------------------------------------
+/// @struct   CountingStats
+/// @note StatsPolicy that records into the StatsRegistry of its Tag. Lists
+/// sharing a Tag share a registry, so subsystems can be told apart, e.g.,
+///
+///     using OrderList = AL::ArrayList<Order, AL::DoublingGrowth,
+///                                     std::allocator<Order>, 0,
+///                                     AL::CountingStats<struct OrdersTag>>;
+///     AL::CountingStats<OrdersTag>::registry().snapshot();
+/// ----------------------------------------------------------------------
+
+template <class Tag = void>
+struct CountingStats {
+    static constexpr bool enabled = true;
     
-    /// ----------------------------------------------------------------------
-    /// @function begin
-    ///
-    /// @return Returns an iterator to the beginning of the container.
-    /// ----------------------------------------------------------------------
+    /// Returns the registry shared by every list using this Tag.
+    static StatsRegistry& registry() noexcept
+    {
+        static StatsRegistry instance;
+        return instance;
+    }
     
-    iterator begin() { return iterator(m_data); };
-    const_iterator begin() const { return iterator (m_data); };
+    static void on_allocate(std::size_t bytes) noexcept { add(registry().bytes_allocated, bytes); }
+    static void on_deallocate(std::size_t bytes) noexcept { add(registry().bytes_freed, bytes); }
     
-    /// ----------------------------------------------------------------------
-    /// @function end
-    ///
-    /// @return Returns an iterator to the end of the container.
-    /// ----------------------------------------------------------------------
-
-    iterator end() { return iterator(m_data + m_size); };
-    const_iterator end() const { return iterator(m_data + m_size); };
+    static void on_reallocate(std::size_t /* old_capacity */, std::size_t new_capacity) noexcept
+    {
+        add(registry().reallocations, 1);
+        
+        auto& peak = registry().peak_capacity;
+        std::uint64_t current = peak.load(std::memory_order_relaxed);
+        
+        while (current < new_capacity &&
+               !peak.compare_exchange_weak(current, new_capacity, std::memory_order_relaxed)) {}
+    }
     
-    /// ----------------------------------------------------------------------
-    /// @function empty
-    ///
-    /// @return Returns 'True' if the size of the container is 0, empty.
-    /// ----------------------------------------------------------------------
+    static void on_relocate(std::size_t count, bool copied) noexcept
+    {
+        add(copied ? registry().elements_copied : registry().elements_moved, count);
+    }
     
-    bool empty() const { return size() == 0; }
+    static void on_insert_shift(std::size_t count) noexcept  { add(registry().insert_shifted, count); }
+    static void on_erase_shift(std::size_t count) noexcept   { add(registry().erase_shifted, count); }
+    static void on_live_size(std::ptrdiff_t bytes) noexcept  { add(registry().live_bytes, bytes); }
+    static void on_live_capacity(std::ptrdiff_t bytes) noexcept { add(registry().capacity_bytes, bytes); }
     
-    /// ----------------------------------------------------------------------
-    /// @function size
-    ///
-    /// @return Returns the number of elements in the container.
-    /// ----------------------------------------------------------------------
+private:
+    template <class Counter, class Value>
+    static void add(std::atomic<Counter>& counter, Value value) noexcept
+    {
+        counter.fetch_add(static_cast<Counter>(value), std::memory_order_relaxed);
+    }
+};
+
+/// ----------------------------------------------------------------------
+/// @function write_prometheus
+/// @param    output     holds the stream the metrics are written to
+/// @param    stats      holds the counters to export
+/// @param    prefix     holds the prefix of every metric name
+/// @return   Returns output, holding the counters in the Prometheus text
+///           exposition format.
+/// ----------------------------------------------------------------------
+
+inline std::ostream& write_prometheus(std::ostream& output, const StatsSnapshot& stats,
+                                      std::string_view prefix = "arraylist")
+{
+    const auto metric = [&](std::string_view name, const char* type, auto value) {
+        output << "# TYPE " << prefix << '_' << name << ' ' << type << '\n'
+               << prefix << '_' << name << ' ' << value << '\n';
+    };
     
-    size_type size() const { return m_size; }
+    metric("reallocations_total",   "counter", stats.reallocations);
+    metric("allocated_bytes_total", "counter", stats.bytes_allocated);
+    metric("freed_bytes_total",     "counter", stats.bytes_freed);
+    metric("peak_capacity",         "gauge",   stats.peak_capacity);
+    metric("moved_elements_total",  "counter", stats.elements_moved);
+    metric("copied_elements_total", "counter", stats.elements_copied);
+    metric("insert_shifted_total",  "counter", stats.insert_shifted);
+    metric("erase_shifted_total",   "counter", stats.erase_shifted);
+    metric("live_bytes",            "gauge",   stats.live_bytes);
+    metric("capacity_bytes",        "gauge",   stats.capacity_bytes);
+    metric("slack_bytes",           "gauge",   stats.slack_bytes());
     
-    /// ----------------------------------------------------------------------
-    /// @function capacity
-    ///
-    /// @return Returns the capacity of the container, which is the maximum
-    /// number of elements the container can hold without needing reallocation.
-    /// ----------------------------------------------------------------------
+    return output;
+}
+
+//! ************************* Check Policies ************************* !//
+
+/// ----------------------------------------------------------------------
+/// @struct   ThrowChecks
+/// @note Default CheckPolicy, range errors throw std::out_of_range. A
+/// CheckPolicy provides
+///
+///     static void check(bool in_range);
+///     static void check_subscript(bool in_range);
+///
+/// check() receives the result of validating the position given to at,
+/// front, back, insert, emplace and erase; check_subscript() that of the
+/// index given to operator[]. Each must return only when in_range is true
+/// or the policy ignores errors. ThrowChecks leaves operator[] unchecked.
+/// ----------------------------------------------------------------------
+
+struct ThrowChecks {
+    static void check(bool in_range)
+    {
+        if (!in_range)
+        {
+            throw std::out_of_range{ "Accessed position is out of range!" };
+        }
+    }
     
-    size_type capacity() const { return m_capacity; }
+    static void check_subscript(bool /* in_range */) noexcept {}
+};
+
+/// ----------------------------------------------------------------------
+/// @struct   NoChecks
+/// @note CheckPolicy that checks nothing, for release builds. Out of range
+/// positions are undefined behavior, as with raw pointers.
+/// ----------------------------------------------------------------------
+
+struct NoChecks {
+    static void check(bool /* in_range */) noexcept {}
+    static void check_subscript(bool /* in_range */) noexcept {}
+};
+
+/// ----------------------------------------------------------------------
+/// @struct   AssertChecks
+/// @note CheckPolicy that asserts every position, operator[] included, in
+/// debug builds and checks nothing once NDEBUG is defined.
+/// ----------------------------------------------------------------------
+
+struct AssertChecks {
+    static void check(bool in_range) noexcept
+    {
+        assert(in_range && "Accessed position is out of range!");
+        (void)in_range;
+    }
     
-    /// ----------------------------------------------------------------------
-    /// @function clear
-    ///
-    /// @note Resets the size of the container to 0, clearing the container.
-    /// Doesn't deallocate memory or destroy the elements, just marks the
-    /// container as empty by setting its size to zero.
-    /// ----------------------------------------------------------------------
+    static void check_subscript(bool in_range) noexcept { check(in_range); }
+};
+
+/// ----------------------------------------------------------------------
+/// @struct   HardenedChecks
+/// @note CheckPolicy that checks every position, operator[] included, and
+/// aborts on a range error instead of unwinding, so hardened builds pay a
+/// compare and a never-taken branch per access.
+/// ----------------------------------------------------------------------
+
+struct HardenedChecks {
+    static void check(bool in_range) noexcept
+    {
+        if (!in_range) [[unlikely]]
+        {
+            std::fputs("AL::ArrayList: accessed position is out of range!\n", stderr);
+            std::abort();
+        }
+    }
     
-    void clear() { m_size = 0; }
+    static void check_subscript(bool in_range) noexcept { check(in_range); }
+};
+
+//! *************************** Allocators *************************** !//
+
+/// Size of a transparent huge page on x86-64 and most AArch64 kernels.
+inline constexpr std::size_t huge_page_size = std::size_t(2) << 20;
+
+/// ----------------------------------------------------------------------
+/// @struct   AlignedAllocator
+/// @note Allocator whose storage starts on an Alignment-byte boundary,
+/// e.g., 64 for cache-line aligned rows or AVX-512 loads. An Alignment
+/// below alignof(T) is raised to alignof(T). Every ArrayList reallocation
+/// goes through the allocator, so the alignment holds for the storage
+/// after any push_back, insert, resize, operator+=, copy or assignment.
+///
+/// Allocations of at least HugePageThreshold bytes, when it isn't 0, are
+/// rounded up to whole huge pages, aligned to huge_page_size and marked
+/// with madvise(MADV_HUGEPAGE) so the kernel backs them with transparent
+/// huge pages, cutting TLB misses on large lists. The advice is a hint;
+/// where it is unavailable the storage is just huge-page aligned.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t Alignment = 64, std::size_t HugePageThreshold = 0>
+struct AlignedAllocator {
+    static_assert(std::has_single_bit(Alignment), "AlignedAllocator alignment must be a power of two");
     
-    /// ----------------------------------------------------------------------
-    /// @function push_back
-    ///
-    /// @param    value    holds the 'value' to append
-    /// @note Appends the given element value to the end of the container.
-    /// If the new size() is greater than capacity(), reallocation occurs.
-    /// ----------------------------------------------------------------------
+    typedef T value_type;
     
-    void push_back(const value_type& value);
+    static constexpr std::size_t alignment = std::max(Alignment, alignof(T));
     
-    /// ----------------------------------------------------------------------
-    /// @function insert
-    /// @param    pos        holds the position to be inserted to
-    /// @param    value    holds the new element to be inserted
-    /// @return   Returns an iterator pointing to the newly inserted element.
-    /// @note     Inserts the new element 'value', at the iterator 'pos'.
-    /// ----------------------------------------------------------------------
+    template <class U>
+    struct rebind { using other = AlignedAllocator<U, Alignment, HugePageThreshold>; };
     
-    iterator insert(iterator pos, const value_type& value);
+    AlignedAllocator() noexcept = default;
     
-    /// ----------------------------------------------------------------------
-    /// @function erase
-    /// @param    pos  holds the position to be erased
-    /// @return   Returns an iterator pointing to the element immediately
-    ///           following the erased element.
-    /// @note Removes the element at the position indicated by the iterator.
-    /// ----------------------------------------------------------------------
+    template <class U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment, HugePageThreshold>&) noexcept {}
     
-    iterator erase(iterator pos);
+    T* allocate(std::size_t count)
+    {
+        if (count > (std::numeric_limits<std::size_t>::max() - huge_page_size) / sizeof(T))
+        {
+            throw std::bad_array_new_length{};
+        }
+        
+        const std::size_t bytes = count * sizeof(T);
+        
+        if (uses_huge_pages(bytes))
+        {
+            const std::size_t rounded = (bytes + huge_page_size - 1) / huge_page_size * huge_page_size;
+            void* data = ::operator new(rounded, std::align_val_t{ huge_page_size });
+#if defined(MADV_HUGEPAGE)
+            ::madvise(data, rounded, MADV_HUGEPAGE);
+#endif
+            return static_cast<T*>(data);
+        }
+        return static_cast<T*>(::operator new(bytes, std::align_val_t{ alignment }));
+    }
     
-    /// ----------------------------------------------------------------------
-    /// @function resize
-    /// @param    count    holds the new size of the desired container
-    /// @note Resizes the container to the specified 'count'. If the current
-    /// size is greater than 'count', the container is reduced to its first
-    /// 'count' elements. If the current size is less than count, additional
-    /// default-constructed elements are appended.
-    /// ----------------------------------------------------------------------
+    void deallocate(T* data, std::size_t count) noexcept
+    {
+        ::operator delete(data, std::align_val_t{ uses_huge_pages(count * sizeof(T)) ? huge_page_size : alignment });
+    }
     
-    void resize(size_type count);
+    template <class U>
+    friend bool operator==(const AlignedAllocator&, const AlignedAllocator<U, Alignment, HugePageThreshold>&) noexcept
+    {
+        return true;
+    }
     
-    /// ----------------------------------------------------------------------
+private:
+    static constexpr bool uses_huge_pages(std::size_t bytes) noexcept
+    {
+        return HugePageThreshold != 0 && bytes >= HugePageThreshold;
+    }
+};
+
+/// ----------------------------------------------------------------------
+/// @struct   from_range_t
+/// @note Tag selecting the ArrayList constructor that copies a range,
+/// e.g., AL::ArrayList<int> list(AL::from_range, view).
+/// ----------------------------------------------------------------------
+
+struct from_range_t { explicit from_range_t() = default; };
+inline constexpr from_range_t from_range{};
+
+//! ************************** Serialization ************************* !//
+
+namespace detail {
+
+/// ----------------------------------------------------------------------
+/// @struct   SerialHeader
+/// @note The 16 bytes in front of every list written by write_to():
+///
+///     bytes 0-3    magic "ALST"
+///     byte  4      format version, currently 1
+///     byte  5      byte order of the elements, 0 little and 1 big endian
+///     bytes 6-7    element size, 0 when elements go through a serializer
+///     bytes 8-15   element count
+///
+/// The header itself is always little-endian. The elements are written in
+/// the writer's byte order, so neither side swaps bytes in the usual case.
+/// ----------------------------------------------------------------------
+
+struct SerialHeader {
+    static constexpr std::size_t   size    = 16;
+    static constexpr unsigned char version = 1;
+    static constexpr unsigned char native_byte_order = std::endian::native == std::endian::big;
+
+    unsigned char byte_order   = native_byte_order;
+    std::uint16_t element_size = 0;
+    std::uint64_t count        = 0;
+
+    void encode(unsigned char* bytes) const noexcept
+    {
+        bytes[0] = 'A'; bytes[1] = 'L'; bytes[2] = 'S'; bytes[3] = 'T';
+        bytes[4] = version;
+        bytes[5] = byte_order;
+        for (std::size_t index = 0; index < 2; ++index)
+        {
+            bytes[6 + index] = static_cast<unsigned char>(element_size >> (8 * index));
+        }
+        for (std::size_t index = 0; index < 8; ++index)
+        {
+            bytes[8 + index] = static_cast<unsigned char>(count >> (8 * index));
+        }
+    }
+
+    static SerialHeader decode(const unsigned char* bytes)
+    {
+        if (bytes[0] != 'A' || bytes[1] != 'L' || bytes[2] != 'S' || bytes[3] != 'T' ||
+            bytes[4] != version || bytes[5] > 1)
+        {
+            throw std::runtime_error{ "Data is not an ArrayList of a supported version!" };
+        }
+
+        SerialHeader header;
+        header.byte_order   = bytes[5];
+        header.element_size = static_cast<std::uint16_t>(bytes[6] | bytes[7] << 8);
+        for (std::size_t index = 0; index < 8; ++index)
+        {
+            header.count |= std::uint64_t(bytes[8 + index]) << (8 * index);
+        }
+        return header;
+    }
+
+    // element size recorded for T, 0 for elements written by a serializer
+    template <class T>
+    static constexpr std::uint16_t element_size_of() noexcept
+    {
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            static_assert(sizeof(T) <= 0xFFFF, "Element is too large to serialize in bulk");
+            return static_cast<std::uint16_t>(sizeof(T));
+        }
+        return 0;
+    }
+
+    // throws unless the elements can be read back as T
+    template <class T>
+    void check() const
+    {
+        if (element_size != element_size_of<T>())
+        {
+            throw std::runtime_error{ "Data holds elements of a different size!" };
+        }
+        if constexpr (std::is_trivially_copyable_v<T> && !std::is_arithmetic_v<T> && !std::is_enum_v<T>)
+        {
+            if (byte_order != native_byte_order)
+            {
+                throw std::runtime_error{ "Data was written with a different byte order!" };
+            }
+        }
+        if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        {
+            throw std::runtime_error{ "Data holds more elements than fit in memory!" };
+        }
+    }
+};
+
+/// Most bytes a reader allocates ahead of the data that has arrived, so a
+/// corrupt or truncated count fails on the missing data, not on a huge
+/// allocation.
+inline constexpr std::size_t serial_chunk_bytes = std::size_t(1) << 20;
+
+/// ----------------------------------------------------------------------
+/// @function reverse_bytes
+/// @param    data     holds the first element
+/// @param    count    holds the number of elements
+/// @note Converts arithmetic elements written on a host of the other byte
+/// order.
+/// ----------------------------------------------------------------------
+
+template <class T>
+void reverse_bytes(T* data, std::size_t count) noexcept
+{
+    auto* bytes = reinterpret_cast<unsigned char*>(data);
+    for (std::size_t index = 0; index < count; ++index, bytes += sizeof(T))
+    {
+        std::reverse(bytes, bytes + sizeof(T));
+    }
+}
+
+} // namespace detail
+
+/// ----------------------------------------------------------------------
+/// @struct   serializer
+/// @note Binary encoding of one element for write_to() and read_from().
+/// Trivially copyable elements are written as raw bytes in one piece and
+/// don't use it; any other T needs a specialization that provides
+///
+///     static void write(std::ostream& output, const T& value);
+///     static T    read(std::istream& input);
+///
+/// where read throws std::runtime_error when the input ends early.
+/// Specializations for std::basic_string and for lists are provided.
+/// ----------------------------------------------------------------------
+
+template <class T>
+struct serializer;
+
+template <class CharT, class Traits, class StringAllocator>
+struct serializer<std::basic_string<CharT, Traits, StringAllocator>> {
+    using string_type = std::basic_string<CharT, Traits, StringAllocator>;
+
+    static void write(std::ostream& output, const string_type& value)
+    {
+        unsigned char length[8];
+        for (std::size_t index = 0; index < 8; ++index)
+        {
+            length[index] = static_cast<unsigned char>(std::uint64_t(value.size()) >> (8 * index));
+        }
+        output.write(reinterpret_cast<const char*>(length), sizeof length);
+        output.write(reinterpret_cast<const char*>(value.data()),
+                     static_cast<std::streamsize>(value.size() * sizeof(CharT)));
+    }
+
+    static string_type read(std::istream& input)
+    {
+        unsigned char length[8];
+        std::uint64_t size = 0;
+        if (!input.read(reinterpret_cast<char*>(length), sizeof length))
+        {
+            throw std::runtime_error{ "Input ended inside a string!" };
+        }
+        for (std::size_t index = 0; index < 8; ++index)
+        {
+            size |= std::uint64_t(length[index]) << (8 * index);
+        }
+
+        string_type value;
+        if (size > value.max_size())
+        {
+            throw std::runtime_error{ "Data holds a string longer than fits in memory!" };
+        }
+
+        // grow with the data that arrives rather than trusting the length
+        const std::size_t chunk = std::max<std::size_t>(1, detail::serial_chunk_bytes / sizeof(CharT));
+        for (auto remaining = static_cast<std::size_t>(size); remaining != 0;)
+        {
+            const std::size_t step = std::min(chunk, remaining);
+            const std::size_t done = value.size();
+            value.resize(done + step);
+            if (!input.read(reinterpret_cast<char*>(value.data() + done),
+                            static_cast<std::streamsize>(step * sizeof(CharT))))
+            {
+                throw std::runtime_error{ "Input ended inside a string!" };
+            }
+            remaining -= step;
+        }
+        return value;
+    }
+};
+
+//! *************************** Formatting *************************** !//
+
+/// ----------------------------------------------------------------------
+/// @struct   FormatOptions
+/// @note Layout used by write_formatted() and to_string(). A list longer
+/// than max_elements is elided: its first and last elements are written
+/// around the ellipsis, e.g., {1,2,...,9,10} for max_elements == 4.
+/// ----------------------------------------------------------------------
+
+struct FormatOptions {
+    std::string_view prefix       = "{";
+    std::string_view separator    = ",";
+    std::string_view suffix       = "}";
+    std::string_view ellipsis     = "...";
+    std::size_t      max_elements = std::numeric_limits<std::size_t>::max();
+};
+
+namespace detail {
+
+/// Element types formatted with std::to_chars instead of operator<<;
+/// bool and the character types print as text, not as numbers.
+template <class T>
+inline constexpr bool is_fast_formattable_v =
+    std::is_arithmetic_v<T> &&
+    !std::is_same_v<T, bool> && !std::is_same_v<T, char> && !std::is_same_v<T, signed char> &&
+    !std::is_same_v<T, unsigned char> && !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char8_t> &&
+    !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>;
+
+/// ----------------------------------------------------------------------
+/// @function format_number
+/// @param    first       holds the start of the free buffer space
+/// @param    last        holds the end of the free buffer space
+/// @param    value       holds the number to format
+/// @param    precision   holds the significant digits of floating-point
+///                       values, or -1 for the shortest exact form
+/// @return   Returns the end of the written text, or nullptr if it didn't
+///           fit.
+/// ----------------------------------------------------------------------
+
+template <class T>
+char* format_number(char* first, char* last, T value, int precision) noexcept
+{
+    std::to_chars_result result;
+    
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        result = precision < 0 ? std::to_chars(first, last, value)
+                               : std::to_chars(first, last, value, std::chars_format::general, precision);
+    }
+    else
+    {
+        result = std::to_chars(first, last, value);
+    }
+    return result.ec == std::errc() ? result.ptr : nullptr;
+}
+
+/// ----------------------------------------------------------------------
+/// @function format_elements
+/// @param    data        holds the first element
+/// @param    size        holds the number of elements
+/// @param    options     holds the layout
+/// @param    precision   holds the precision passed to format_number
+/// @param    write       holds the callable taking (const char*, size)
+///                       blocks of text
+/// @param    write_item  holds the callable formatting an element that
+///                       format_number can't
+/// @note Text is collected in one buffer that is handed to write when it
+/// fills, so the sink sees a few large blocks instead of two calls per
+/// element.
+/// ----------------------------------------------------------------------
+
+template <class T, class Write, class WriteItem>
+void format_elements(const T* data, std::size_t size, const FormatOptions& options,
+                     int precision, Write&& write, WriteItem&& write_item)
+{
+    char  buffer[8192];
+    char* position = buffer;
+    char* const end = buffer + sizeof buffer;
+    
+    const auto flush = [&] {
+        if (position != buffer)
+        {
+            write(static_cast<const char*>(buffer), static_cast<std::size_t>(position - buffer));
+            position = buffer;
+        }
+    };
+    
+    const auto put = [&](std::string_view text) {
+        if (text.size() > static_cast<std::size_t>(end - position))
+        {
+            flush();
+            if (text.size() > sizeof buffer)
+            {
+                write(text.data(), text.size());
+                return;
+            }
+        }
+        position = std::copy(text.begin(), text.end(), position);
+    };
+    
+    const auto put_item = [&](const T& item) {
+        if constexpr (is_fast_formattable_v<T>)
+        {
+            char* next = format_number(position, end, item, precision);
+            if (!next)
+            {
+                flush();
+                next = format_number(position, end, item, precision);
+            }
+            if (next)
+            {
+                position = next;
+                return;
+            }
+        }
+        flush();
+        write_item(item);
+    };
+    
+    const bool        elided = size > options.max_elements;
+    const std::size_t head   = elided ? options.max_elements - options.max_elements / 2 : size;
+    const std::size_t tail   = elided ? options.max_elements / 2 : 0;
+    
+    put(options.prefix);
+    for (std::size_t index = 0; index < head; ++index)
+    {
+        if (index != 0)
+        {
+            put(options.separator);
+        }
+        put_item(data[index]);
+    }
+    if (elided)
+    {
+        if (head != 0)
+        {
+            put(options.separator);
+        }
+        put(options.ellipsis);
+        for (std::size_t index = size - tail; index < size; ++index)
+        {
+            put(options.separator);
+            put_item(data[index]);
+        }
+    }
+    put(options.suffix);
+    flush();
+}
+
+/// ----------------------------------------------------------------------
+/// @function has_plain_number_format
+/// @param    output   holds the stream to check
+/// @return   Returns 'True' if output would format numbers the way
+///           std::to_chars does: decimal, no flags, no field width and the
+///           classic locale.
+/// ----------------------------------------------------------------------
+
+inline bool has_plain_number_format(const std::ostream& output)
+{
+    constexpr auto flags = std::ios_base::oct | std::ios_base::hex | std::ios_base::floatfield |
+                           std::ios_base::showbase | std::ios_base::showpoint |
+                           std::ios_base::showpos | std::ios_base::uppercase;
+    
+    return (output.flags() & flags) == 0 && output.width() == 0 &&
+           output.getloc() == std::locale::classic();
+}
+
+} // namespace detail
+
+/// ----------------------------------------------------------------------
+/// @function write_formatted
+/// @param    output      holds the stream to write to
+/// @param    range       holds the contiguous container to write
+/// @param    options     holds the separators and the elision limit
+/// @return   Returns output.
+/// @note Integers and floating-point numbers are formatted with
+/// std::to_chars, floating-point in the shortest form that reads back
+/// exactly; other elements use operator<<.
+/// ----------------------------------------------------------------------
+
+template <std::ranges::contiguous_range R>
+std::ostream& write_formatted(std::ostream& output, const R& range, const FormatOptions& options = {})
+{
+    using value_type = std::ranges::range_value_t<R>;
+    
+    detail::format_elements(std::ranges::data(range), std::ranges::size(range), options, -1,
+                            [&output](const char* text, std::size_t count) {
+                                output.write(text, static_cast<std::streamsize>(count));
+                            },
+                            [&output](const value_type& item) { output << item; });
+    return output;
+}
+
+/// ----------------------------------------------------------------------
+/// @function to_string
+/// @param    range       holds the contiguous container to format
+/// @param    options     holds the separators and the elision limit
+/// @return   Returns the text write_formatted() would write.
+/// ----------------------------------------------------------------------
+
+template <std::ranges::contiguous_range R>
+std::string to_string(const R& range, const FormatOptions& options = {})
+{
+    using value_type = std::ranges::range_value_t<R>;
+    
+    std::string text;
+    detail::format_elements(std::ranges::data(range), std::ranges::size(range), options, -1,
+                            [&text](const char* block, std::size_t count) { text.append(block, count); },
+                            [&text](const value_type& item) {
+                                std::ostringstream stream;
+                                stream << item;
+                                text += stream.str();
+                            });
+    return text;
+}
+
+namespace detail {
+
+/// ----------------------------------------------------------------------
+/// @struct   RepeatIterator
+/// @note Forward iterator that yields the same value at every position,
+/// so 'count copies of value' can be inserted as an ordinary range.
+/// ----------------------------------------------------------------------
+
+template <class T>
+struct RepeatIterator {
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = T;
+    using reference         = const T&;
+    using pointer           = const T*;
+    
+    RepeatIterator() = default;
+    explicit RepeatIterator(const T& value) noexcept : m_value(&value) {}
+    
+    reference operator*() const noexcept { return *m_value; }
+    pointer operator->() const noexcept { return m_value; }
+    
+    RepeatIterator& operator++() noexcept { ++m_index; return *this; }
+    RepeatIterator operator++(int) noexcept { RepeatIterator old = *this; ++m_index; return old; }
+    
+    friend bool operator==(const RepeatIterator& lhs, const RepeatIterator& rhs) noexcept
+    {
+        return lhs.m_index == rhs.m_index;
+    }
+    
+    const T* m_value = nullptr;  ///< The repeated value.
+    difference_type m_index = 0; ///< Position, only used for comparisons.
+};
+
+//! ************************** SIMD Kernels ************************** !//
+
+/// True for the element types the vector kernels handle: integers of 1,
+/// 2, 4 or 8 bytes other than bool, float and double.
+template <class T>
+inline constexpr bool is_simd_element_v =
+    (std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+     (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)) ||
+    std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+#if defined(__GNUC__) || defined(__clang__)
+
+/// ----------------------------------------------------------------------
+/// @struct   FindKernel, CountKernel, MismatchKernel
+/// @note Search loops written once with the compiler's vector extensions
+/// and compiled for Bytes-wide registers: SSE2 or NEON for 16, AVX2 for
+/// 32 and AVX-512 for 64. Lanes compare with T's own ==, so floating-point
+/// elements keep their NaN and signed-zero semantics.
+/// ----------------------------------------------------------------------
+
+struct FindKernel {
+    /// Returns the index of the first element equal to value, or size.
+    template <std::size_t Bytes, class T>
+    [[gnu::always_inline]] static std::size_t run(const T* data, std::size_t size, T value) noexcept
+    {
+        typedef T vector_type __attribute__((vector_size(Bytes)));
+        constexpr std::size_t lanes = Bytes / sizeof(T);
+        
+        vector_type needle;
+        for (std::size_t lane = 0; lane < lanes; ++lane)
+        {
+            needle[lane] = value;
+        }
+        
+        std::size_t index = 0;
+        
+        for (; index + lanes <= size; index += lanes)
+        {
+            vector_type block;
+            std::memcpy(&block, data + index, Bytes);
+            const auto equal = block == needle;
+            
+            // OR the lanes together as words to test for any match
+            std::uint64_t words[Bytes / 8];
+            std::memcpy(words, &equal, Bytes);
+            std::uint64_t any = 0;
+            for (const auto word : words)
+            {
+                any |= word;
+            }
+            
+            if (any != 0)
+            {
+                for (std::size_t lane = 0; lane < lanes; ++lane)
+                {
+                    if (equal[lane])
+                    {
+                        return index + lane;
+                    }
+                }
+            }
+        }
+        
+        for (; index < size; ++index)
+        {
+            if (data[index] == value)
+            {
+                return index;
+            }
+        }
+        return size;
+    }
+};
+
+struct CountKernel {
+    /// Returns the number of elements equal to value.
+    template <std::size_t Bytes, class T>
+    [[gnu::always_inline]] static std::size_t run(const T* data, std::size_t size, T value) noexcept
+    {
+        typedef T vector_type __attribute__((vector_size(Bytes)));
+        constexpr std::size_t lanes = Bytes / sizeof(T);
+        
+        // each equal lane is -1, so subtracting counts up; the signed lane
+        // counters are flushed before they can overflow, at the latest every
+        // 2^16 blocks so wide lanes are safe at any size too
+        constexpr std::size_t flush_every =
+            (std::size_t{ 1 } << std::min<std::size_t>(8 * sizeof(T) - 1, 16)) - 1;
+        
+        vector_type needle;
+        for (std::size_t lane = 0; lane < lanes; ++lane)
+        {
+            needle[lane] = value;
+        }
+        
+        using counter_type = decltype(needle == needle);
+        
+        counter_type counters{};
+        std::size_t  pending = 0;
+        std::size_t  total   = 0;
+        
+        const auto drain = [&] {
+            for (std::size_t lane = 0; lane < lanes; ++lane)
+            {
+                total += static_cast<std::size_t>(counters[lane]);
+            }
+            counters = counter_type{};
+            pending  = 0;
+        };
+        
+        std::size_t index = 0;
+        
+        for (; index + lanes <= size; index += lanes)
+        {
+            vector_type block;
+            std::memcpy(&block, data + index, Bytes);
+            counters -= block == needle;
+            
+            if (++pending == flush_every)
+            {
+                drain();
+            }
+        }
+        drain();
+        
+        for (; index < size; ++index)
+        {
+            total += data[index] == value;
+        }
+        return total;
+    }
+};
+
+struct MismatchKernel {
+    /// Returns the index of the first position where lhs and rhs differ,
+    /// or size.
+    template <std::size_t Bytes, class T>
+    [[gnu::always_inline]] static std::size_t run(const T* lhs, const T* rhs, std::size_t size) noexcept
+    {
+        typedef T vector_type __attribute__((vector_size(Bytes)));
+        constexpr std::size_t lanes = Bytes / sizeof(T);
+        
+        std::size_t index = 0;
+        
+        for (; index + lanes <= size; index += lanes)
+        {
+            vector_type left;
+            vector_type right;
+            std::memcpy(&left, lhs + index, Bytes);
+            std::memcpy(&right, rhs + index, Bytes);
+            const auto differ = left != right;
+            
+            std::uint64_t words[Bytes / 8];
+            std::memcpy(words, &differ, Bytes);
+            std::uint64_t any = 0;
+            for (const auto word : words)
+            {
+                any |= word;
+            }
+            
+            if (any != 0)
+            {
+                for (std::size_t lane = 0; lane < lanes; ++lane)
+                {
+                    if (differ[lane])
+                    {
+                        return index + lane;
+                    }
+                }
+            }
+        }
+        
+        for (; index < size; ++index)
+        {
+            if (lhs[index] != rhs[index])
+            {
+                return index;
+            }
+        }
+        return size;
+    }
+};
+
+#if defined(__x86_64__) || defined(__i386__)
+
+/// Widest vector unit of the running CPU, detected once.
+enum class SimdLevel { baseline, avx2, avx512 };
+
+inline SimdLevel simd_level() noexcept
+{
+    static const SimdLevel level = [] {
+        __builtin_cpu_init();
+        
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+        {
+            return SimdLevel::avx512;
+        }
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return SimdLevel::avx2;
+        }
+        return SimdLevel::baseline;
+    }();
+    
+    return level;
+}
+
+template <class Kernel, class... Args>
+[[gnu::target("avx2")]] std::size_t run_avx2(Args... args) noexcept
+{
+    return Kernel::template run<32>(args...);
+}
+
+template <class Kernel, class... Args>
+[[gnu::target("avx512f,avx512bw")]] std::size_t run_avx512(Args... args) noexcept
+{
+    return Kernel::template run<64>(args...);
+}
+
+#endif
+
+/// ----------------------------------------------------------------------
+/// @function simd_dispatch
+/// @param    args    holds the arguments of Kernel::run
+/// @return   Returns the result of Kernel::run, compiled for the widest
+///           vector unit the CPU supports.
+/// ----------------------------------------------------------------------
+
+template <class Kernel, class... Args>
+std::size_t simd_dispatch(Args... args) noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+    switch (simd_level())
+    {
+        case SimdLevel::avx512: return run_avx512<Kernel>(args...);
+        case SimdLevel::avx2:   return run_avx2<Kernel>(args...);
+        case SimdLevel::baseline: break;
+    }
+#endif
+    return Kernel::template run<16>(args...);
+}
+
+#endif // vector extensions
+
+/// ----------------------------------------------------------------------
+/// @function find_index, count_equal, mismatch_index
+/// @note Search primitives behind the ArrayList members. Vectorized for
+/// is_simd_element_v types on GCC and Clang, plain loops otherwise.
+/// ----------------------------------------------------------------------
+
+template <class T>
+std::size_t find_index(const T* data, std::size_t size, const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    if constexpr (is_simd_element_v<T>)
+    {
+        return simd_dispatch<FindKernel>(data, size, value);
+    }
+    else
+#endif
+    {
+        return static_cast<std::size_t>(std::find(data, data + size, value) - data);
+    }
+}
+
+template <class T>
+std::size_t count_equal(const T* data, std::size_t size, const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    if constexpr (is_simd_element_v<T>)
+    {
+        return simd_dispatch<CountKernel>(data, size, value);
+    }
+    else
+#endif
+    {
+        return static_cast<std::size_t>(std::count(data, data + size, value));
+    }
+}
+
+template <class T>
+std::size_t mismatch_index(const T* lhs, const T* rhs, std::size_t size)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    if constexpr (is_simd_element_v<T>)
+    {
+        return simd_dispatch<MismatchKernel>(lhs, rhs, size);
+    }
+    else
+#endif
+    {
+        return static_cast<std::size_t>(std::mismatch(lhs, lhs + size, rhs).first - lhs);
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @class    StatsGauge
+/// @note Element count that reports, in bytes, its value to a live gauge
+/// of StatsPolicy for as long as it exists, and every change after. Used
+/// for the size and capacity of instrumented lists.
+/// ----------------------------------------------------------------------
+
+template <class StatsPolicy, std::size_t ElementSize, bool IsCapacity>
+class StatsGauge {
+public:
+    StatsGauge(std::size_t value = 0) noexcept : m_value(value) { report(m_value); }
+    StatsGauge(const StatsGauge& other) noexcept : StatsGauge(other.m_value) {}
+    ~StatsGauge() { report(-static_cast<std::ptrdiff_t>(m_value)); }
+    
+    StatsGauge& operator=(const StatsGauge& other) noexcept { return *this = other.m_value; }
+    
+    StatsGauge& operator=(std::size_t value) noexcept
+    {
+        report(static_cast<std::ptrdiff_t>(value) - static_cast<std::ptrdiff_t>(m_value));
+        m_value = value;
+        return *this;
+    }
+    
+    operator std::size_t() const noexcept { return m_value; }
+    
+    StatsGauge& operator++() noexcept { return *this = m_value + 1; }
+    StatsGauge& operator--() noexcept { return *this = m_value - 1; }
+    StatsGauge& operator+=(std::size_t count) noexcept { return *this = m_value + count; }
+    StatsGauge& operator-=(std::size_t count) noexcept { return *this = m_value - count; }
+    
+private:
+    static void report(std::ptrdiff_t count) noexcept
+    {
+        const auto bytes = count * static_cast<std::ptrdiff_t>(ElementSize);
+        
+        if constexpr (IsCapacity)
+        {
+            StatsPolicy::on_live_capacity(bytes);
+        }
+        else
+        {
+            StatsPolicy::on_live_size(bytes);
+        }
+    }
+    
+    std::size_t m_value;  ///< The element count.
+};
+
+/// ----------------------------------------------------------------------
+/// @struct   InlineStorage
+/// @note Uninitialized room for N elements kept inside the container
+/// itself. The N == 0 specialization is empty and takes no space.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N>
+struct InlineStorage {
+    T*       data() noexcept       { return reinterpret_cast<T*>(m_bytes); }
+    const T* data() const noexcept { return reinterpret_cast<const T*>(m_bytes); }
+    
+    alignas(T) unsigned char m_bytes[N * sizeof(T)];  ///< Raw element storage.
+};
+
+template <class T>
+struct InlineStorage<T, 0> {
+    T*       data() noexcept       { return nullptr; }
+    const T* data() const noexcept { return nullptr; }
+};
+
+} // namespace detail
+
+/// ----------------------------------------------------------------------
+/// @struct   ContiguousIterator
+/// @note Random-access iterator over contiguous elements of type T. The
+/// const iterator is ContiguousIterator<const T>, which a mutable iterator
+/// converts to. Models std::contiguous_iterator, so standard algorithms
+/// take their pointer-based paths.
+/// ----------------------------------------------------------------------
+
+template <class T>
+struct ContiguousIterator {
+public:
+    // Iterator Type Aliases
+    using iterator_concept  = std::contiguous_iterator_tag;
+    using iterator_category = std::random_access_iterator_tag;
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = std::remove_cv_t<T>;
+    using reference         = T&;
+    using pointer           = T*;
+    
+    /// ------------------------------------------------------------------
+    /// @function ContiguousIterator   </! Iterator Default Constructor !/>
+    ///
+    /// @note     Constructs a singular iterator holding nullptr.
+    /// ------------------------------------------------------------------
+    
+    constexpr ContiguousIterator() noexcept = default;
+    
+    /// ------------------------------------------------------------------
+    /// @function ContiguousIterator
+    /// @param    ptr         holds the element the iterator points to
+    /// @note     Initializes instance variables.
+    /// ------------------------------------------------------------------
+    
+    constexpr explicit ContiguousIterator(pointer ptr) noexcept : m_ptr(ptr) {}
+    
+    /// ------------------------------------------------------------------
+    /// @function ContiguousIterator   </! Converting Constructor !/>
+    /// @param    other    holds a mutable iterator
+    /// @note     Converts a mutable iterator to a const iterator.
+    /// ------------------------------------------------------------------
+    
+    template <class U>
+    requires (std::is_const_v<T> && std::is_same_v<const U, T>)
+    constexpr ContiguousIterator(const ContiguousIterator<U>& other) noexcept
+    : m_ptr(other.base()) {}
+    
+    /// ------------------------------------------------------------------
+    /// @function base
+    ///
+    /// @return   Returns the underlying pointer.
+    /// ------------------------------------------------------------------
+    
+    constexpr pointer base() const noexcept { return m_ptr; }
+    
+    /// ------------------------------------------------------------------
+    /// @function operator*  </! Dereference Operator !/>
+    ///
+    /// @return   Returns a reference to the object pointed to by m_ptr.
+    /// ------------------------------------------------------------------
+    
+    constexpr reference operator*() const noexcept { return *m_ptr; }
+    
+    /// ------------------------------------------------------------------
+    /// @function operator->  </! Member Access Operator !/>
+    ///
+    /// @return   Returns a pointer to the object.
+    /// -----------------------------------------------------------------
+    
+    constexpr pointer operator->() const noexcept { return m_ptr; }
+    
+    /// ------------------------------------------------------------------
+    /// @function operator[]  </! Subscript Operator !/>
+    /// @param    n      holds the offset from the current element
+    /// @return   Returns a reference to the element n positions away.
+    /// ------------------------------------------------------------------
+    
+    constexpr reference operator[](difference_type n) const noexcept { return m_ptr[n]; }
+    
+    /// ------------------------------------------------------------------
+    /// @function operator++  </! Increment Operator !/>
+    ///
+    /// @return Returns incremented reference to the iterator.
+    /// ------------------------------------------------------------------
+    
+    constexpr ContiguousIterator& operator++() noexcept { ++m_ptr; return *this; }
+    constexpr ContiguousIterator operator++(int) noexcept { return ContiguousIterator(m_ptr++); }
+    
+    /// ------------------------------------------------------------------
+    /// @function operator--  </! Decrement Operator !/>
+    ///
+    /// @return Returns decremented reference to the iterator.
+    /// ------------------------------------------------------------------
+    
+    constexpr ContiguousIterator& operator--() noexcept { --m_ptr; return *this; }
+    constexpr ContiguousIterator operator--(int) noexcept { return ContiguousIterator(m_ptr--); }
+    
+    /// ------------------------------------------------------------------
+    /// @function operator+=  </! Compound Addition Operator !/>
+    /// @param    n      holds the number of positions to advance
+    /// @return Returns a reference to the advanced iterator.
+    /// ------------------------------------------------------------------
+    
+    constexpr ContiguousIterator& operator+=(difference_type n) noexcept { m_ptr += n; return *this; }
+    
+    /// ------------------------------------------------------------------
+    /// @function operator-=  </! Compound Subtraction Operator !/>
+    /// @param    n      holds the number of positions to step back
+    /// @return Returns a reference to the moved iterator.
+    /// ------------------------------------------------------------------
+    
+    constexpr ContiguousIterator& operator-=(difference_type n) noexcept { m_ptr -= n; return *this; }
+    
+    /// ------------------------------------------------------------------
+    /// @function operator+   </! Addition Operator !/>
+    /// @param    it     holds the iterator to advance
+    /// @param    n      holds the number of positions to advance
+    /// @return   Returns an iterator n positions after it.
+    /// ------------------------------------------------------------------
+    
+    friend constexpr ContiguousIterator operator+(ContiguousIterator it, difference_type n) noexcept { return it += n; }
+    friend constexpr ContiguousIterator operator+(difference_type n, ContiguousIterator it) noexcept { return it += n; }
+    
+    /// ------------------------------------------------------------------
+    /// @function operator-   </! Subtraction Operator !/>
+    /// @param    it     holds the iterator to step back
+    /// @param    n      holds the number of positions to step back
+    /// @return   Returns an iterator n positions before it.
+    /// ------------------------------------------------------------------
+    
+    friend constexpr ContiguousIterator operator-(ContiguousIterator it, difference_type n) noexcept { return it -= n; }
+    
+    /// ------------------------------------------------------------------
+    /// @function operator-   </! Difference Operator !/>
+    /// @param    lhs        -Left-hand side iterator
+    /// @param    rhs        -Right-hand side iterator
+    /// @return   Returns the number of elements from rhs to lhs.
+    /// ------------------------------------------------------------------
+    
+    friend constexpr difference_type operator-(const ContiguousIterator& lhs, const ContiguousIterator& rhs) noexcept
+    {
+        return lhs.m_ptr - rhs.m_ptr;
+    }
+    
+    /// ------------------------------------------------------------------
+    /// @function operator==    </! Equality Comparison Operator !/>
+    /// @param    lhs        -Left-hand side iterator
+    /// @param    rhs        -Right-hand side iterator
+    /// @return   True if lhs 'does' compare equal to rhs, else false.
+    /// ------------------------------------------------------------------
+    
+    friend constexpr bool operator==(const ContiguousIterator& lhs, const ContiguousIterator& rhs) noexcept
+    {
+        return lhs.m_ptr == rhs.m_ptr;
+    }
+    
+    /// ------------------------------------------------------------------
+    /// @function operator<=>   </! Three-Way Comparison Operator !/>
+    /// @param    lhs        -Left-hand side iterator
+    /// @param    rhs        -Right-hand side iterator
+    /// @return   Orders the iterators by the position they point to.
+    /// ------------------------------------------------------------------
+    
+    friend constexpr std::strong_ordering operator<=>(const ContiguousIterator& lhs, const ContiguousIterator& rhs) noexcept
+    {
+        return lhs.m_ptr <=> rhs.m_ptr;
+    }
+    
+    /// ------------------------------------------------------------------
+    
+private:
+    pointer m_ptr{}; ///< Iterator pointer
+};  // ContiguousIterator class
+
+/// ----------------------------------------------------------------------
+/// @class    BasicArrayList
+/// @note The ArrayList container without a virtual destructor, so it holds
+/// no vtable pointer: an empty BasicArrayList<int> is three words. Lists
+/// without inline storage are trivially relocatable when their allocator
+/// is, so a BasicArrayList of BasicArrayLists grows with memcpy.
+/// CheckPolicy decides how every position passed in is validated, see
+/// ThrowChecks.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy = DoublingGrowth, class Allocator = std::allocator<T>,
+          std::size_t InlineCapacity = 0, class StatsPolicy = NoStats,
+          class CheckPolicy = ThrowChecks>
+class BasicArrayList {
+public:
+    
+    // type aliases
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using pointer         = value_type*;
+    using const_pointer   = const value_type*;
+    using difference_type = std::ptrdiff_t;
+    using iterator        = ContiguousIterator<value_type>;
+    using const_iterator  = ContiguousIterator<const value_type>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using allocator_type  = Allocator;
+    
+    static_assert(std::is_same_v<typename std::allocator_traits<Allocator>::value_type, T>,
+                  "Allocator::value_type must be the same as T");
+    static_assert(std::is_same_v<typename std::allocator_traits<Allocator>::pointer, T*>,
+                  "ArrayList requires an Allocator with raw pointers");
+    
+    /// ----------------------------------------------------------------------
+    /// @function BasicArrayList </! Default Constructor !/>
+    ///
+    /// @note Default constructor. Constructs an empty ArrayList, no memory
+    /// is allocated until an element doesn't fit in the inline capacity.
+    /// ----------------------------------------------------------------------
+    
+    BasicArrayList() noexcept(noexcept(allocator_type())) : BasicArrayList(allocator_type()) {}
+    
+    /// ----------------------------------------------------------------------
+    /// @function BasicArrayList
+    /// @param    alloc    holds the allocator used for all the storage
+    /// @note Constructs an empty ArrayList that allocates through 'alloc'.
+    /// ----------------------------------------------------------------------
+    
+    explicit BasicArrayList(const allocator_type& alloc) noexcept
+    : m_capacity(InlineCapacity), m_size(0), m_data(nullptr), m_alloc(alloc)
+    {
+        m_data = inline_data();
+    }
+    
+    /// ----------------------------------------------------------------------
+    /// @function BasicArrayList
+    /// @param count    holds the number of elements to construct
+    /// @param alloc    holds the allocator used for all the storage
+    /// @note Constructs an ArrayList with count copies of the default value
+    /// of value_type, e.g., the default value for an int is 0.
+    /// ----------------------------------------------------------------------
+    
+    BasicArrayList(size_type count, const allocator_type& alloc = allocator_type());
+    
+    /// ----------------------------------------------------------------------
+    /// @function BasicArrayList
+    /// @param count    holds the number of elements to construct
+    /// @param value    holds the value to copy
+    /// @param alloc    holds the allocator used for all the storage
+    /// @note Constructs an ArrayList with count copies of 'value'.
+    /// ----------------------------------------------------------------------
+    
+    BasicArrayList(size_type count, const value_type& value,
+              const allocator_type& alloc = allocator_type())
+    : BasicArrayList(alloc)
+    {
+        assign(count, value);
+    }
+    
+    /// ----------------------------------------------------------------------
+    /// @function BasicArrayList
+    /// @param    source   Holds initializer list of elements
+    /// @param    alloc    holds the allocator used for all the storage
+    /// @note     Constructs a container with a copy of the source elements.
+    /// ----------------------------------------------------------------------
+    BasicArrayList(const std::initializer_list<value_type>& source,
+              const allocator_type& alloc = allocator_type());
+    
+    /// ----------------------------------------------------------------------
+    /// @function BasicArrayList
+    /// @param    first    holds the first element to copy
+    /// @param    last     holds one past the last element to copy
+    /// @param    alloc    holds the allocator used for all the storage
+    /// @note     Constructs a container with a copy of [first, last).
+    /// ----------------------------------------------------------------------
+    
+    template <std::input_iterator InputIt>
+    BasicArrayList(InputIt first, InputIt last, const allocator_type& alloc = allocator_type())
+    : BasicArrayList(alloc)
+    {
+        insert(cend(), first, last);
+    }
+    
+    /// ----------------------------------------------------------------------
+    /// @function BasicArrayList
+    /// @param    range    holds the elements to copy
+    /// @param    alloc    holds the allocator used for all the storage
+    /// @note     Constructs a container with a copy of the elements of range.
+    /// ----------------------------------------------------------------------
+    
+    template <std::ranges::input_range R>
+    BasicArrayList(from_range_t, R&& range, const allocator_type& alloc = allocator_type())
+    : BasicArrayList(alloc)
+    {
+        append_range(std::forward<R>(range));
+    }
+    
+    /// ----------------------------------------------------------------------
+    /// @function BasicArrayList  </! Copy Constructor !/>
+    /// @param    other    holds a reference to other ArrayList
+    /// @param    alloc    holds the allocator used for all the storage
+    /// @note     Makes a deep copy of another ArrayList. Without 'alloc', the
+    ///           allocator is obtained from other's through
+    ///           select_on_container_copy_construction().
+    /// ----------------------------------------------------------------------
+    
+    BasicArrayList(const BasicArrayList& other)
+    : BasicArrayList(other, alloc_traits::select_on_container_copy_construction(other.m_alloc)) {}
+    
+    BasicArrayList(const BasicArrayList& other, const allocator_type& alloc);
+    
+    /// ----------------------------------------------------------------------
+    /// @function BasicArrayList  </! Move Constructor !/>
+    /// @param    other     holds the state of another object being moved
+    /// @note Creates container with source contents using move semantics.
+    /// Elements held in other's inline storage are relocated one by one.
+    /// ----------------------------------------------------------------------
+    
+    BasicArrayList(BasicArrayList&& other)
+    noexcept(InlineCapacity == 0 || std::is_nothrow_move_constructible_v<T>)
+    : BasicArrayList(other.m_alloc)
+    {
+        take_storage(other);
+    }
+    
+    /// ----------------------------------------------------------------------
+    /// @function BasicArrayList
+    /// @param    other     holds the state of another object being moved
+    /// @param    alloc     holds the allocator used for all the storage
+    /// @note Takes over other's storage when 'alloc' compares equal to its
+    /// allocator, otherwise move-constructs the elements one by one.
+    /// ----------------------------------------------------------------------
+    
+    BasicArrayList(BasicArrayList&& other, const allocator_type& alloc);
+    
+    /// ----------------------------------------------------------------------
+    /// @function ~BasicArrayList  </! Deconstructor !/>
+    ///
+    /// @note Releases any resources the object aquired over its lifetime.
+    /// ----------------------------------------------------------------------
+    ~BasicArrayList();
+    
+    /// ----------------------------------------------------------------------
+    /// @function get_allocator
+    ///
+    /// @return Returns a copy of the allocator used by the container.
+    /// ----------------------------------------------------------------------
+    
+    allocator_type get_allocator() const { return m_alloc; }
+    
+    /// ----------------------------------------------------------------------
+    /// @function at
+    /// @param    pos     Zero-based index of the element to access
+    /// @return   Returns a reference to an element at the specified position.
+    /// ----------------------------------------------------------------------
+    
+    reference at(size_type pos);
+    const_reference at(size_type pos) const;
+    
+    /// ----------------------------------------------------------------------
+    /// @function front
+    ///
+    /// @return Returns a reference to the first element in the container.
+    /// ----------------------------------------------------------------------
+    
+    reference front();
+    const_reference front() const;
+    
+    /// ----------------------------------------------------------------------
+    /// @function back
+    ///
+    /// @return Returns a reference to the last element in the container.
+    /// ----------------------------------------------------------------------
+    
+    reference back() { CheckPolicy::check(size() != 0); return *(begin() + size() - 1); }
+    const_reference back() const { CheckPolicy::check(size() != 0); return *(begin() + size() - 1); }
+    
+    /// ----------------------------------------------------------------------
+    /// @function begin
+    ///
+    /// @return Returns an iterator to the beginning of the container.
+    /// ----------------------------------------------------------------------
+    
+    iterator begin() noexcept { return iterator(m_data); }
+    const_iterator begin() const noexcept { return const_iterator(m_data); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    
+    /// ----------------------------------------------------------------------
+    /// @function end
+    ///
+    /// @return Returns an iterator to the end of the container.
+    /// ----------------------------------------------------------------------
+
+    iterator end() noexcept { return iterator(m_data + m_size); }
+    const_iterator end() const noexcept { return const_iterator(m_data + m_size); }
+    const_iterator cend() const noexcept { return end(); }
+    
+    /// ----------------------------------------------------------------------
+    /// @function rbegin
+    ///
+    /// @return Returns a reverse iterator to the last element of the container.
+    /// ----------------------------------------------------------------------
+    
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+    
+    /// ----------------------------------------------------------------------
+    /// @function rend
+    ///
+    /// @return Returns a reverse iterator before the first element.
+    /// ----------------------------------------------------------------------
+    
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const noexcept { return rend(); }
+    
+    /// ----------------------------------------------------------------------
+    /// @function data
+    ///
+    /// @return Returns a pointer to the first element of the storage.
+    /// ----------------------------------------------------------------------
+    
+    pointer data() noexcept { return m_data; }
+    const_pointer data() const noexcept { return m_data; }
+    
+    /// ----------------------------------------------------------------------
+    /// @function empty
+    ///
+    /// @return Returns 'True' if the size of the container is 0, empty.
+    /// ----------------------------------------------------------------------
+    
+    bool empty() const { return size() == 0; }
+    
+    /// ----------------------------------------------------------------------
+    /// @function size
+    ///
+    /// @return Returns the number of elements in the container.
+    /// ----------------------------------------------------------------------
+    
+    size_type size() const { return m_size; }
+    
+    /// ----------------------------------------------------------------------
+    /// @function capacity
+    ///
+    /// @return Returns the capacity of the container, which is the maximum
+    /// number of elements the container can hold without needing reallocation.
+    /// ----------------------------------------------------------------------
+    
+    size_type capacity() const { return m_capacity; }
+    
+    /// ----------------------------------------------------------------------
+    /// @function reserve
+    /// @param    new_capacity    holds the minimum capacity to make room for
+    /// @note Increases the capacity to at least 'new_capacity', reallocating
+    /// once. Does nothing if the capacity is already large enough.
+    /// ----------------------------------------------------------------------
+    
+    void reserve(size_type new_capacity);
+    
+    /// ----------------------------------------------------------------------
+    /// @function shrink_to_fit
+    ///
+    /// @note Reallocates the storage so that capacity() equals size(),
+    /// releasing the unused capacity.
+    /// ----------------------------------------------------------------------
+    
+    void shrink_to_fit();
+    
+    /// ----------------------------------------------------------------------
+    /// @function clear
+    ///
+    /// @note Destroys every element and resets the size of the container to 0.
+    /// Doesn't deallocate memory, the capacity is left unchanged.
+    /// ----------------------------------------------------------------------
+    
+    void clear();
+    
+    /// ----------------------------------------------------------------------
+    /// @function push_back
+    ///
+    /// @param    value    holds the 'value' to append
+    /// @note Appends the given element value to the end of the container.
+    /// If the new size() is greater than capacity(), reallocation occurs.
+    /// ----------------------------------------------------------------------
+    
+    void push_back(const value_type& value);
+    void push_back(value_type&& value);
+    
+    /// ----------------------------------------------------------------------
+    /// @function emplace_back
+    /// @param    args     holds the arguments forwarded to the constructor
+    /// @return   Returns a reference to the new element.
+    /// @note Constructs a new element in place at the end of the container.
+    /// If the new size() is greater than capacity(), reallocation occurs.
+    /// ----------------------------------------------------------------------
+    
+    template <class... Args>
+    reference emplace_back(Args&&... args);
+    
+    /// ----------------------------------------------------------------------
+    /// @function insert
+    /// @param    pos        holds the position to be inserted to
+    /// @param    value    holds the new element to be inserted
+    /// @return   Returns an iterator pointing to the newly inserted element.
+    /// @note     Inserts the new element 'value', at the iterator 'pos'.
+    /// ----------------------------------------------------------------------
+    
+    iterator insert(const_iterator pos, const value_type& value);
+    iterator insert(const_iterator pos, value_type&& value);
+    
+    /// ----------------------------------------------------------------------
+    /// @function insert
+    /// @param    pos      holds the position to be inserted to
+    /// @param    count    holds the number of copies to insert
+    /// @param    value    holds the value to copy
+    /// @return   Returns an iterator pointing to the first inserted element.
+    /// @note     Inserts 'count' copies of 'value' at the iterator 'pos'.
+    /// ----------------------------------------------------------------------
+    
+    iterator insert(const_iterator pos, size_type count, const value_type& value);
+    
+    /// ----------------------------------------------------------------------
+    /// @function insert
+    /// @param    pos      holds the position to be inserted to
+    /// @param    first    holds the first element to insert
+    /// @param    last     holds one past the last element to insert
+    /// @return   Returns an iterator pointing to the first inserted element.
+    /// @note     Inserts a copy of [first, last) at the iterator 'pos'. The
+    ///           range must not come from the container itself.
+    /// ----------------------------------------------------------------------
+    
+    template <std::input_iterator InputIt>
+    iterator insert(const_iterator pos, InputIt first, InputIt last)
+    {
+        return insert_range(pos, std::ranges::subrange(first, last));
+    }
+    
+    iterator insert(const_iterator pos, std::initializer_list<value_type> source)
+    {
+        return insert_range(pos, source);
+    }
+    
+    /// ----------------------------------------------------------------------
+    /// @function insert_range
+    /// @param    pos      holds the position to be inserted to
+    /// @param    range    holds the elements to insert
+    /// @return   Returns an iterator pointing to the first inserted element.
+    /// @note Inserts a copy of the elements of range at the iterator 'pos'.
+    /// Forward ranges are inserted with at most one reallocation and a
+    /// single shift of the tail. Single-pass ranges are appended, then
+    /// rotated into place.
+    /// ----------------------------------------------------------------------
+    
+    template <std::ranges::input_range R>
+    iterator insert_range(const_iterator pos, R&& range);
+    
+    /// ----------------------------------------------------------------------
+    /// @function append_range
+    /// @param    range    holds the elements to append
+    /// @note     Appends a copy of the elements of range to the container.
+    /// ----------------------------------------------------------------------
+    
+    template <std::ranges::input_range R>
+    void append_range(R&& range)
+    {
+        insert_range(cend(), std::forward<R>(range));
+    }
+    
+    /// ----------------------------------------------------------------------
+    /// @function assign
+    /// @param    count    holds the new size of the container
+    /// @param    value    holds the value to copy
+    /// @note     Replaces the contents with 'count' copies of 'value'.
+    /// ----------------------------------------------------------------------
+    
+    void assign(size_type count, const value_type& value)
+    {
+        assign_counted(detail::RepeatIterator<value_type>(value), count);
+    }
+    
+    /// ----------------------------------------------------------------------
+    /// @function assign
+    /// @param    first    holds the first element to copy
+    /// @param    last     holds one past the last element to copy
+    /// @note     Replaces the contents with a copy of [first, last).
+    /// ----------------------------------------------------------------------
+    
+    template <std::input_iterator InputIt>
+    void assign(InputIt first, InputIt last)
+    {
+        assign_range(std::ranges::subrange(first, last));
+    }
+    
+    void assign(std::initializer_list<value_type> source)
+    {
+        assign_range(source);
+    }
+    
+    /// ----------------------------------------------------------------------
+    /// @function assign_range
+    /// @param    range    holds the elements to copy
+    /// @note Replaces the contents with a copy of the elements of range. The
+    /// existing elements and storage are reused where possible, with at most
+    /// one reallocation for forward ranges.
+    /// ----------------------------------------------------------------------
+    
+    template <std::ranges::input_range R>
+    void assign_range(R&& range);
+    
+    /// ----------------------------------------------------------------------
+    /// @function emplace
+    /// @param    pos      holds the position to be inserted to
+    /// @param    args     holds the arguments forwarded to the constructor
+    /// @return   Returns an iterator pointing to the new element.
+    /// @note     Constructs a new element in place, at the iterator 'pos'.
+    /// ----------------------------------------------------------------------
+    
+    template <class... Args>
+    iterator emplace(const_iterator pos, Args&&... args);
+    
+    /// ----------------------------------------------------------------------
+    /// @function erase
+    /// @param    pos  holds the position to be erased
+    /// @return   Returns an iterator pointing to the element immediately
+    ///           following the erased element.
+    /// @note Removes the element at the position indicated by the iterator.
+    /// ----------------------------------------------------------------------
+    
+    iterator erase(const_iterator pos);
+    
+    /// ----------------------------------------------------------------------
+    /// @function erase
+    /// @param    first  holds the first element to be erased
+    /// @param    last   holds one past the last element to be erased
+    /// @return   Returns an iterator pointing to the element that followed
+    ///           the erased range.
+    /// @note Removes the elements in [first, last), shifting the tail once.
+    /// ----------------------------------------------------------------------
+    
+    iterator erase(const_iterator first, const_iterator last);
+    
+    /// ----------------------------------------------------------------------
+    /// @function swap_remove
+    /// @param    pos  holds the position to be erased
+    /// @return   Returns an iterator to the same position, which now holds the
+    ///           former last element, or end() if pos was the last element.
+    /// @note Removes the element in O(1) by moving the last element into its
+    /// place. The order of the remaining elements is not kept.
+    /// ----------------------------------------------------------------------
+    
+    iterator swap_remove(const_iterator pos);
+    
+    /// ----------------------------------------------------------------------
+    /// @function erase_if
+    /// @param    pred     holds the predicate selecting elements to remove
+    /// @return   Returns the number of elements removed.
+    /// @note Removes every element for which pred returns true, keeping the
+    /// order of the rest. The survivors are compacted in a single pass and
+    /// the vacated tail is destroyed once, O(n) however many are removed.
+    /// ----------------------------------------------------------------------
+    
+    template <class Predicate>
+    size_type erase_if(Predicate pred);
+    
+    /// ----------------------------------------------------------------------
+    /// @function resize
+    /// @param    count    holds the new size of the desired container
+    /// @note Resizes the container to the specified 'count'. If the current
+    /// size is greater than 'count', the container is reduced to its first
+    /// 'count' elements. If the current size is less than count, additional
+    /// default-constructed elements are appended. Reallocation only occurs
+    /// when 'count' is greater than capacity().
+    /// ----------------------------------------------------------------------
+    
+    void resize(size_type count);
+    
+    /// ----------------------------------------------------------------------
     /// @function swap
     /// @param    other   holds a reference to other contianer
     /// @note Exchanges the contents of the container with those of another,
-    /// without copying any elements.
+    /// without copying any elements. The allocators are swapped only if they
+    /// propagate on swap; otherwise they must compare equal.
+    /// ----------------------------------------------------------------------
+    
+    void swap(BasicArrayList& other)
+    noexcept(InlineCapacity == 0 || std::is_nothrow_move_constructible_v<T>);
+    
+    /// Returned by index_of() when no element matches.
+    static constexpr size_type npos = static_cast<size_type>(-1);
+    
+    /// ----------------------------------------------------------------------
+    /// @function find
+    /// @param    value    holds the value to search for
+    /// @return   Returns an iterator to the first element equal to value,
+    ///           or end() if there is none.
+    /// @note Integer and floating-point elements are compared with the
+    /// widest vector unit the CPU supports.
+    /// ----------------------------------------------------------------------
+    
+    iterator find(const value_type& value);
+    const_iterator find(const value_type& value) const;
+    
+    /// ----------------------------------------------------------------------
+    /// @function contains
+    /// @param    value    holds the value to search for
+    /// @return   Returns 'True' if an element is equal to value.
+    /// ----------------------------------------------------------------------
+    
+    bool contains(const value_type& value) const { return index_of(value) != npos; }
+    
+    /// ----------------------------------------------------------------------
+    /// @function count
+    /// @param    value    holds the value to count
+    /// @return   Returns the number of elements equal to value.
+    /// ----------------------------------------------------------------------
+    
+    size_type count(const value_type& value) const;
+    
+    /// ----------------------------------------------------------------------
+    /// @function index_of
+    /// @param    value    holds the value to search for
+    /// @return   Returns the position of the first element equal to value,
+    ///           or npos if there is none.
+    /// ----------------------------------------------------------------------
+    
+    size_type index_of(const value_type& value) const;
+    
+    /// ----------------------------------------------------------------------
+    /// @function compare
+    /// @param    other    holds the container to compare with
+    /// @return   Returns a negative value, 0 or a positive value when the
+    ///           container orders lexicographically before, equal to or after
+    ///           other.
+    /// @note The first position where the elements aren't == decides, using
+    /// operator<; otherwise the shorter container orders first.
+    /// ----------------------------------------------------------------------
+    
+    int compare(const BasicArrayList& other) const;
+    
+    /// ----------------------------------------------------------------------
+    /// @function write_to
+    /// @param    output   holds the stream to write to
+    /// @return   Returns output.
+    /// @note Writes a SerialHeader followed by the elements. Trivially
+    /// copyable elements are written straight from the storage in a single
+    /// call; other elements go through serializer<T>.
+    /// ----------------------------------------------------------------------
+    
+    std::ostream& write_to(std::ostream& output) const;
+    
+    /// ----------------------------------------------------------------------
+    /// @function read_from
+    /// @param    input    holds the stream to read from
+    /// @return   Returns input.
+    /// @note Replaces the contents with a list written by write_to(). Throws
+    /// std::runtime_error for data in another format, cut short or too large
+    /// to allocate, leaving the container unchanged. Storage grows with the
+    /// data read, never ahead of it by more than a megabyte or the elements
+    /// already read. Arithmetic elements written with the other byte order
+    /// are converted.
+    /// ----------------------------------------------------------------------
+    
+    std::istream& read_from(std::istream& input);
+    
+    /// ----------------------------------------------------------------------
+    /// @function operator=  </Move Assignment Operator/>
+    /// @param    other     holds contents of source container
+    /// @return   Transfers assets from source object to target object using move semantics
+    /// @return *this
+    /// @note If the allocator doesn't propagate on move assignment and the two
+    /// allocators differ, the elements are moved one by one instead.
+    /// ----------------------------------------------------------------------
+    
+    BasicArrayList& operator=(BasicArrayList&& other)
+    noexcept((std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
+              std::allocator_traits<Allocator>::is_always_equal::value) &&
+             (InlineCapacity == 0 || std::is_nothrow_move_constructible_v<T>));
+    
+    /// ----------------------------------------------------------------------
+    /// @function operator=   </Copy Assignment Operator/>
+    /// @param     rhs          holds contents of other container
+    /// @return  Replaces the contents of the container
+    ///          with a copy of the contents of rhs
+    /// @return *this
+    /// @note The allocator is replaced by rhs's allocator if it propagates
+    ///       on copy assignment.
+    /// ----------------------------------------------------------------------
+    
+    BasicArrayList& operator=(const BasicArrayList& rhs);
+    
+    /// ----------------------------------------------------------------------
+    /// @function operator+=
+    /// @param other    holds other contents to be appended
+    /// @return Appends the contents of other to the contianer.
+    /// ----------------------------------------------------------------------
+    
+    BasicArrayList& operator+=(const BasicArrayList& other);
+    
+    /// ----------------------------------------------------------------------
+    /// @function operator[]
+    /// @param    index  holds the position of the element you want to access
+    /// @return   Returns a reference as an array element
+    /// ----------------------------------------------------------------------
+    reference operator[](size_type index);
+    const_reference operator[](size_type index) const;
+    
+protected:
+    using alloc_traits = std::allocator_traits<allocator_type>;
+    
+    /// True when elements are constructed with plain placement new, which lets
+    /// the standard uninitialized algorithms take their memmove fast paths.
+    static constexpr bool uses_std_allocator = std::is_same_v<allocator_type, std::allocator<T>>;
+    
+    /// ----------------------------------------------------------------------
+    /// @function allocate
+    /// @param    count    holds the number of elements to make room for
+    /// @return   Returns uninitialized storage for 'count' elements, or
+    ///           nullptr when 'count' is 0.
+    /// ----------------------------------------------------------------------
+    
+    pointer allocate(size_type count);
+    
+    /// ----------------------------------------------------------------------
+    /// @function deallocate
+    /// @param    data     holds storage obtained from allocate()
+    /// @param    count    holds the number of elements it was allocated for
+    /// @note     Releases the storage, the elements must already be destroyed.
+    /// ----------------------------------------------------------------------
+    
+    void deallocate(pointer data, size_type count);
+    
+    /// ----------------------------------------------------------------------
+    /// @function construct
+    /// @param    location    holds the uninitialized slot to construct in
+    /// @param    args        holds the arguments forwarded to the constructor
+    /// @note     Constructs an element through the allocator.
+    /// ----------------------------------------------------------------------
+    
+    template <class... Args>
+    void construct(pointer location, Args&&... args)
+    {
+        alloc_traits::construct(m_alloc, location, std::forward<Args>(args)...);
+    }
+    
+    /// ----------------------------------------------------------------------
+    /// @function uninitialized_copy
+    /// @param    first    holds the first element to copy
+    /// @param    last     holds one past the last element to copy
+    /// @param    dest     holds the uninitialized destination storage
+    /// @return   Returns one past the last element constructed in 'dest'.
+    /// @note Constructs copies of [first, last) in 'dest' through the
+    /// allocator. If a copy throws, the ones already made are destroyed.
+    /// ----------------------------------------------------------------------
+    
+    template <class InputIt>
+    pointer uninitialized_copy(InputIt first, InputIt last, pointer dest);
+    
+    /// ----------------------------------------------------------------------
+    /// @function uninitialized_value_construct
+    /// @param    first    holds the first slot to construct in
+    /// @param    last     holds one past the last slot to construct in
+    /// @note Value-initializes every element in [first, last) through the
+    /// allocator. If one throws, the ones already made are destroyed.
+    /// ----------------------------------------------------------------------
+    
+    void uninitialized_value_construct(pointer first, pointer last);
+    
+    /// ----------------------------------------------------------------------
+    /// @function destroy
+    /// @param    first    holds the first element to destroy
+    /// @param    last     holds one past the last element to destroy
+    /// @note     Runs the destructor of every element in [first, last).
+    /// ----------------------------------------------------------------------
+    
+    void destroy(pointer first, pointer last);
+    
+    /// ----------------------------------------------------------------------
+    /// @function reallocate
+    /// @param    new_capacity    holds the capacity of the new storage
+    /// @note Relocates the live elements into new storage of 'new_capacity'
+    /// elements and releases the old storage. 'new_capacity' must not be
+    /// less than size(). A capacity that fits inline moves the elements
+    /// back into the inline storage.
+    /// ----------------------------------------------------------------------
+    
+    void reallocate(size_type new_capacity);
+    
+    /// ----------------------------------------------------------------------
+    /// @function inline_data / is_inline
+    ///
+    /// @return Returns the inline storage (nullptr without any), and whether
+    ///         the elements currently live there rather than on the heap.
+    /// ----------------------------------------------------------------------
+    
+    pointer inline_data() noexcept { return m_inline.data(); }
+    bool is_inline() const noexcept { return m_data == m_inline.data(); }
+    
+    /// ----------------------------------------------------------------------
+    /// @function take_storage
+    /// @param    other    holds the container whose contents are taken over
+    /// @note Takes over other's heap storage, or relocates its inline
+    /// elements, leaving other empty. *this must be empty and hold no heap
+    /// storage, and the allocators must compare equal.
+    /// ----------------------------------------------------------------------
+    
+    void take_storage(BasicArrayList& other)
+    noexcept(InlineCapacity == 0 || std::is_nothrow_move_constructible_v<T>);
+    
+    /// ----------------------------------------------------------------------
+    /// @function release_storage
+    ///
+    /// @note Destroys the elements, frees any heap storage and returns the
+    /// container to the empty state of a default-constructed one.
+    /// ----------------------------------------------------------------------
+    
+    void release_storage() noexcept;
+    
+    /// ----------------------------------------------------------------------
+    /// @function next_capacity
+    /// @param    required    holds the minimum capacity needed
+    /// @return   Returns the capacity to grow to, as chosen by GrowthPolicy.
+    /// ----------------------------------------------------------------------
+    
+    size_type next_capacity(size_type required) const
+    {
+        return GrowthPolicy::next_capacity(m_capacity, required, sizeof(value_type));
+    }
+    
+    /// ----------------------------------------------------------------------
+    /// @function relocate
+    /// @param    first    holds the first element to relocate
+    /// @param    last     holds one past the last element to relocate
+    /// @param    dest     holds the uninitialized destination storage
+    /// @return   Returns one past the last element constructed in 'dest'.
+    /// @note Copies the bytes of trivially relocatable elements. Otherwise
+    /// move-constructs the elements into 'dest' when value_type's move
+    /// constructor can't throw, or copies them so a failure leaves the
+    /// source untouched. The source is released with destroy_relocated().
+    /// ----------------------------------------------------------------------
+    
+    pointer relocate(pointer first, pointer last, pointer dest);
+    
+    /// ----------------------------------------------------------------------
+    /// @function destroy_relocated
+    /// @param    first    holds the first element relocate() read from
+    /// @param    last     holds one past the last element relocate() read from
+    /// @note Destroys the moved-from source elements. Trivially relocatable
+    /// elements already live on in their new storage, so it does nothing.
+    /// ----------------------------------------------------------------------
+    
+    void destroy_relocated(pointer first, pointer last);
+    
+    /// ----------------------------------------------------------------------
+    /// @function realloc_insert
+    /// @param    index    holds the position of the new element
+    /// @param    args     holds the arguments forwarded to the constructor
+    /// @note Grows the storage and constructs the new element at 'index'
+    /// while the live elements are relocated across.
+    /// ----------------------------------------------------------------------
+    
+    template <class... Args>
+    void realloc_insert(size_type index, Args&&... args);
+    
+    /// ----------------------------------------------------------------------
+    /// @function realloc_gap
+    /// @param    index           holds the position of the first new element
+    /// @param    count           holds the number of new elements
+    /// @param    construct_gap   holds a callable that builds the new elements
+    /// @note Grows the storage to fit 'count' more elements. construct_gap is
+    /// called with the uninitialized slot at 'index' and must construct all
+    /// 'count' elements or none, before the live elements are relocated around
+    /// the gap.
+    /// ----------------------------------------------------------------------
+    
+    template <class ConstructGap>
+    void realloc_gap(size_type index, size_type count, ConstructGap&& construct_gap);
+    
+    /// ----------------------------------------------------------------------
+    /// @function insert_counted
+    /// @param    index    holds the position of the first new element
+    /// @param    first    holds the first element to copy
+    /// @param    count    holds the number of elements to copy
+    /// @note Inserts copies of the 'count' elements starting at 'first' with
+    /// at most one reallocation and one shift of the tail.
+    /// ----------------------------------------------------------------------
+    
+    template <class ForwardIt>
+    void insert_counted(size_type index, ForwardIt first, size_type count);
+    
+    /// ----------------------------------------------------------------------
+    /// @function assign_counted
+    /// @param    first    holds the first element to copy
+    /// @param    count    holds the number of elements to copy
+    /// @note Replaces the contents with copies of the 'count' elements
+    /// starting at 'first'. The new storage is built before the old one is
+    /// released, so the source may be an element of the container.
+    /// ----------------------------------------------------------------------
+    
+    template <class ForwardIt>
+    void assign_counted(ForwardIt first, size_type count);
+    
+    /// Element count, reported to StatsPolicy's live gauges when enabled.
+    template <bool IsCapacity>
+    using gauge_type = std::conditional_t<StatsPolicy::enabled,
+                                          detail::StatsGauge<StatsPolicy, sizeof(T), IsCapacity>,
+                                          size_type>;
+    
+    gauge_type<true>  m_capacity;  ///< The number of elements that can be stored.
+    gauge_type<false> m_size;      ///< The number of elements in use.
+    pointer   m_data;      ///< Dynamically-allocated array custodian.
+    
+    [[no_unique_address]] allocator_type m_alloc;  ///< Source of the storage.
+    
+    [[no_unique_address]] detail::InlineStorage<T, InlineCapacity> m_inline;  ///< Inline elements.
+};  // BasicArrayList class
+
+template <class T, class GrowthPolicy, class Allocator, class StatsPolicy, class CheckPolicy>
+struct is_trivially_relocatable<BasicArrayList<T, GrowthPolicy, Allocator, 0, StatsPolicy, CheckPolicy>>
+: std::bool_constant<is_trivially_relocatable_v<Allocator>> {};
+
+/// ----------------------------------------------------------------------
+/// @class    ArrayList
+/// @note BasicArrayList with a virtual destructor, for code that derives
+/// from the container or deletes it through a base class pointer. All of
+/// the interface is inherited, and an ArrayList converts to and from its
+/// BasicArrayList.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy = DoublingGrowth, class Allocator = std::allocator<T>,
+          std::size_t InlineCapacity = 0, class StatsPolicy = NoStats,
+          class CheckPolicy = ThrowChecks>
+class ArrayList : public BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy> {
+public:
+    using base_type = BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>;
+    
+    using base_type::base_type;
+    
+    ArrayList() = default;
+    ArrayList(const ArrayList&) = default;
+    ArrayList(ArrayList&&) = default;
+    
+    /// ----------------------------------------------------------------------
+    /// @function ArrayList
+    /// @param    other    holds the non-polymorphic list to copy or move
+    /// @note     Converts a BasicArrayList to an ArrayList.
+    /// ----------------------------------------------------------------------
+    
+    ArrayList(const base_type& other) : base_type(other) {}
+    
+    ArrayList(base_type&& other) noexcept(std::is_nothrow_move_constructible_v<base_type>)
+    : base_type(std::move(other)) {}
+    
+    /// ----------------------------------------------------------------------
+    /// @function ArrayList
+    /// @param    source   Holds initializer list of elements
+    /// @param    alloc    holds the allocator used for all the storage
+    /// @note     Redeclared so AL::ArrayList list{ 1, 2, 3 } deduces T.
+    /// ----------------------------------------------------------------------
+    
+    ArrayList(const std::initializer_list<T>& source,
+              const typename base_type::allocator_type& alloc = typename base_type::allocator_type())
+    : base_type(source, alloc) {}
+    
+    /// ----------------------------------------------------------------------
+    /// @function ~ArrayList  </! Deconstructor !/>
+    ///
+    /// @note Virtual, so derived containers are destroyed through a base.
+    /// ----------------------------------------------------------------------
+    
+    virtual ~ArrayList() = default;
+    
+    ArrayList& operator=(const ArrayList&) = default;
+    ArrayList& operator=(ArrayList&&) = default;
+};  // ArrayList class
+
+template <class T>
+BasicArrayList(std::initializer_list<T>) -> BasicArrayList<T>;
+
+template <std::input_iterator InputIt>
+BasicArrayList(InputIt, InputIt) -> BasicArrayList<std::iter_value_t<InputIt>>;
+
+template <std::input_iterator InputIt>
+ArrayList(InputIt, InputIt) -> ArrayList<std::iter_value_t<InputIt>>;
+
+/// ----------------------------------------------------------------------
+/// @typedef  SmallArrayList
+/// @note ArrayList that keeps up to N elements inside the object itself
+/// and only allocates once it grows past N. Moving or swapping a list whose
+/// elements are inline moves the elements instead of a pointer.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class GrowthPolicy = DoublingGrowth,
+          class Allocator = std::allocator<T>>
+using SmallArrayList = ArrayList<T, GrowthPolicy, Allocator, N>;
+
+namespace pmr {
+
+/// ArrayList whose storage comes from a std::pmr::memory_resource, e.g., a
+/// std::pmr::monotonic_buffer_resource arena released all at once.
+template <class T, class GrowthPolicy = DoublingGrowth>
+using ArrayList = AL::ArrayList<T, GrowthPolicy, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+
+/// ----------------------------------------------------------------------
+/// @typedef  InstrumentedArrayList
+/// @note ArrayList that reports its allocations, growth and shifts to
+/// CountingStats<Tag>::registry().
+/// ----------------------------------------------------------------------
+
+template <class T, class Tag = void, class GrowthPolicy = DoublingGrowth>
+using InstrumentedArrayList = ArrayList<T, GrowthPolicy, std::allocator<T>, 0, CountingStats<Tag>>;
+
+/// ----------------------------------------------------------------------
+/// @typedef  AlignedArrayList
+/// @note ArrayList whose storage is always Alignment-byte aligned.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t Alignment = 64, class GrowthPolicy = DoublingGrowth>
+using AlignedArrayList = ArrayList<T, GrowthPolicy, AlignedAllocator<T, Alignment>>;
+
+/// ----------------------------------------------------------------------
+/// @typedef  HugePageArrayList
+/// @note ArrayList whose storage is backed by transparent huge pages once
+/// it reaches Threshold bytes. Capacities from then on are rounded to
+/// whole huge pages, so the rounding costs no memory.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t Threshold = huge_page_size, std::size_t Alignment = 64>
+using HugePageArrayList = ArrayList<T, PageRoundedGrowth<huge_page_size>, AlignedAllocator<T, Alignment, Threshold>>;
+
+/// ----------------------------------------------------------------------
+/// @struct   serializer
+/// @note Lists nest: a list element is written with its own header.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+struct serializer<BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>> {
+    using list_type = BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>;
+    
+    static void write(std::ostream& output, const list_type& value) { value.write_to(output); }
+    
+    static list_type read(std::istream& input)
+    {
+        list_type value;
+        value.read_from(input);
+        return value;
+    }
+};
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+struct serializer<ArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>>
+: serializer<BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>> {
+    using list_type = ArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>;
+    
+    static list_type read(std::istream& input)
+    {
+        list_type value;
+        value.read_from(input);
+        return value;
+    }
+};
+
+/// ----------------------------------------------------------------------
+/// @class    ArrayListView
+/// @note Read-only list over the bytes of a list written by write_to(),
+/// e.g., a received message or a mapped file, without copying them. The
+/// buffer must outlive the view, hold the elements in the host's byte
+/// order and be aligned so that the elements, which start 16 bytes in,
+/// are aligned for T.
+/// ----------------------------------------------------------------------
+
+template <class T>
+class ArrayListView {
+    static_assert(std::is_trivially_copyable_v<T>, "ArrayListView elements must be trivially copyable");
+    
+public:
+    typedef T                 value_type;
+    typedef std::size_t       size_type;
+    typedef std::ptrdiff_t    difference_type;
+    typedef const value_type& reference;
+    typedef const value_type& const_reference;
+    typedef const value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef const value_type* iterator;
+    typedef const value_type* const_iterator;
+    
+    /// ----------------------------------------------------------------------
+    /// @function ArrayListView  </Default Constructor/>
+    /// @note Views no elements.
+    /// ----------------------------------------------------------------------
+    
+    ArrayListView() noexcept = default;
+    
+    /// ----------------------------------------------------------------------
+    /// @function ArrayListView
+    /// @param    buffer   holds the serialized list, which may be followed
+    ///                    by other data
+    /// @note Throws std::runtime_error when buffer doesn't start with a list
+    /// of T in the host's byte order, and std::invalid_argument when the
+    /// elements would be misaligned.
+    /// ----------------------------------------------------------------------
+    
+    explicit ArrayListView(std::span<const std::byte> buffer);
+    
+    const_reference at(size_type index) const
+    {
+        if (index >= m_size)
+        {
+            throw std::out_of_range{ "Accessed position is out of range!" };
+        }
+        return m_data[index];
+    }
+    
+    const_reference front() const { return at(0); }
+    const_reference back() const  { return at(m_size - 1); }
+    
+    const_pointer  data() const noexcept  { return m_data; }
+    const_iterator begin() const noexcept { return m_data; }
+    const_iterator end() const noexcept   { return m_data + m_size; }
+    
+    bool      empty() const noexcept { return m_size == 0; }
+    size_type size() const noexcept  { return m_size; }
+    
+    /// ----------------------------------------------------------------------
+    /// @function serialized_size
+    /// @return   Returns the number of buffer bytes the list occupies, i.e.
+    ///           where the next item in the buffer starts.
+    /// ----------------------------------------------------------------------
+    
+    size_type serialized_size() const noexcept
+    {
+        return detail::SerialHeader::size + m_size * sizeof(T);
+    }
+    
+    const_reference operator[](size_type index) const noexcept { return m_data[index]; }
+    
+    operator std::span<const T>() const noexcept { return { m_data, m_size }; }
+    
+private:
+    const T*  m_data = nullptr;
+    size_type m_size = 0;
+};
+
+template <class List, class... Operands>
+class Concatenation;
+
+namespace detail {
+
+/// True for BasicArrayList and ArrayList specializations.
+template <class L>
+struct is_array_list : std::false_type {};
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+struct is_array_list<BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>> : std::true_type {};
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+struct is_array_list<ArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>> : std::true_type {};
+
+template <class L>
+inline constexpr bool is_array_list_v = is_array_list<std::remove_cvref_t<L>>::value;
+
+template <class C>
+struct is_concatenation : std::false_type {};
+
+template <class List, class... Operands>
+struct is_concatenation<Concatenation<List, Operands...>> : std::true_type {};
+
+template <class C>
+inline constexpr bool is_concatenation_v = is_concatenation<std::remove_cvref_t<C>>::value;
+
+/// Lvalue operands are kept by reference, temporaries are moved in.
+template <class R>
+using concat_operand_t = std::conditional_t<std::is_lvalue_reference_v<R>,
+                                            const std::remove_reference_t<R>&, std::remove_cvref_t<R>>;
+
+/// The list type an operator+ chain yields: that of its first list operand.
+template <class... Operands>
+struct concat_list;
+
+template <class Operand, class... Rest>
+struct concat_list<Operand, Rest...> {
+    using type = typename std::conditional_t<is_array_list_v<Operand>, std::type_identity<std::remove_cvref_t<Operand>>,
+                                    concat_list<Rest...>>::type;
+};
+
+/// The element type of the lists and chains among X and Y.
+template <class X, class Y>
+using concat_value_t = typename std::conditional_t<is_array_list_v<X> || is_concatenation_v<X>,
+                                          std::type_identity<std::remove_cvref_t<X>>,
+                                          std::type_identity<std::remove_cvref_t<Y>>>::type::value_type;
+
+template <class X, class T>
+concept concat_part = is_concatenation_v<X> ||
+                      (std::ranges::forward_range<const std::remove_reference_t<X>&> &&
+                       std::convertible_to<std::ranges::range_reference_t<const std::remove_reference_t<X>&>, T>);
+
+/// Operands of a lazy operator+: a list or chain and a list, chain or
+/// forward range of convertible elements, in either order.
+template <class X, class Y>
+concept concat_operands = (is_array_list_v<X> || is_concatenation_v<X> ||
+                           is_array_list_v<Y> || is_concatenation_v<Y>) &&
+                          concat_part<X, concat_value_t<X, Y>> && concat_part<Y, concat_value_t<X, Y>>;
+
+template <class X>
+auto concat_parts(X&& operand)
+{
+    if constexpr (is_concatenation_v<X>)
+    {
+        if constexpr (std::is_lvalue_reference_v<X>)
+        {
+            return operand.operands();
+        }
+        else
+        {
+            return std::move(operand).operands();
+        }
+    }
+    else
+    {
+        return std::tuple<concat_operand_t<X>>(std::forward<X>(operand));
+    }
+}
+
+template <class... Operands>
+auto make_concatenation(std::tuple<Operands...>&& operands)
+{
+    using list_type = typename concat_list<Operands...>::type;
+    return Concatenation<list_type, Operands...>(std::move(operands));
+}
+
+} // namespace detail
+
+/// ----------------------------------------------------------------------
+/// @class    Concatenation
+/// @note What operator+ returns: the operands of an 'a + b + c' chain,
+/// with the elements copied only when the chain converts to List. The
+/// result is sized once, from the lengths of all operands, instead of
+/// growing through a temporary per '+'. Lvalue operands are referenced and
+/// must outlive the chain, so hold the result as a list, not as 'auto'.
+/// ----------------------------------------------------------------------
+
+template <class List, class... Operands>
+class Concatenation {
+public:
+    typedef List                         list_type;
+    typedef typename List::value_type    value_type;
+    typedef typename List::size_type     size_type;
+    
+    explicit Concatenation(std::tuple<Operands...>&& operands)
+    : m_operands(std::move(operands)) {}
+    
+    /// ----------------------------------------------------------------------
+    /// @function size
+    /// @return   Returns the number of elements the chain yields.
+    /// ----------------------------------------------------------------------
+    
+    size_type size() const
+    {
+        return std::apply([](const auto&... operand) {
+            return (size_type(0) + ... + static_cast<size_type>(std::ranges::distance(operand)));
+        }, m_operands);
+    }
+    
+    bool empty() const { return size() == 0; }
+    
+    /// ----------------------------------------------------------------------
+    /// @function materialize
+    /// @return   Returns a list of the elements of all operands, in order.
+    /// @note Allocates once. A temporary list opening the chain, e.g. in
+    /// 'make() + a', has its storage reused.
+    /// ----------------------------------------------------------------------
+    
+    list_type materialize() const&
+    {
+        list_type result(std::get<list_index>(m_operands).get_allocator());
+        result.reserve(size());
+        std::apply([&result](const auto&... operand) { (result.append_range(operand), ...); }, m_operands);
+        return result;
+    }
+    
+    list_type materialize() &&
+    {
+        using first_type = std::tuple_element_t<0, std::tuple<Operands...>>;
+        
+        if constexpr (std::is_same_v<first_type, list_type>)
+        {
+            const size_type total = size();
+            list_type result(std::move(std::get<0>(m_operands)));
+            result.reserve(total);
+            std::apply([&result](const auto&, const auto&... rest) { (result.append_range(rest), ...); }, m_operands);
+            return result;
+        }
+        else
+        {
+            return materialize();
+        }
+    }
+    
+    operator list_type() const& { return materialize(); }
+    operator list_type() &&     { return std::move(*this).materialize(); }
+    
     /// ----------------------------------------------------------------------
+    /// @function operands
+    /// @return   Returns the operands of the chain, in order.
+    /// ----------------------------------------------------------------------
+    
+    const std::tuple<Operands...>& operands() const& noexcept { return m_operands; }
+    std::tuple<Operands...>&& operands() && noexcept { return std::move(m_operands); }
+    
+    friend bool operator==(const Concatenation& lhs, const list_type& rhs) { return lhs.materialize() == rhs; }
+    
+    friend std::ostream& operator<<(std::ostream& output, const Concatenation& chain)
+    {
+        return output << chain.materialize();
+    }
+    
+private:
+    static constexpr std::size_t list_index = [] {
+        constexpr bool is_list[] = { std::is_same_v<std::remove_cvref_t<Operands>, List>... };
+        std::size_t index = 0;
+        while (!is_list[index]) { ++index; }
+        return index;
+    }();
+    
+    std::tuple<Operands...> m_operands;
+};
+
+//! *********************** Operator Overloads *********************** !//
+
+/// ----------------------------------------------------------------------
+/// @function operator==    </! Equality Comparison Operator !/>
+/// @param    lhs        -Left-hand side dynamic array
+/// @param    rhs        -Right-hand side dynamic array
+/// @return   Returns true if lhs 'does' compare equal to rhs, else false.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+bool operator==(const BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>& lhs, const BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>& rhs);
+
+/// ----------------------------------------------------------------------
+/// @function operator!=    </! Inequality Comparison Operator !/>
+/// @param    lhs        -Left-hand side dynamic array
+/// @param    rhs        -Right-hand side dynamic array
+/// @return   Returns true if lhs is not equal to rhs, else false.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+bool operator!=(const BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>& lhs, const BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>& rhs);
+
+/// ----------------------------------------------------------------------
+/// @function operator+   </! Concatenation Operator !/>
+/// @param    lhs    -Left-hand side list, chain or range
+/// @param    rhs    -Right-hand side list, chain or range
+/// @return   Returns a Concatenation of lhs and rhs, which converts to the
+///           type of the first list operand.
+/// @note One of lhs and rhs must be a list or a chain; the other may be any
+/// forward range of convertible elements, e.g. a std::span.
+/// ----------------------------------------------------------------------
+
+template <class L, class R>
+requires detail::concat_operands<L, R>
+auto operator+(L&& lhs, R&& rhs);
+
+/// ----------------------------------------------------------------------
+/// @function erase, erase_if
+/// @param    list     holds the container to remove elements from
+/// @param    value    holds the value of the elements to remove
+/// @param    pred     holds the predicate selecting elements to remove
+/// @return   Returns the number of elements removed.
+/// @note Uniform container erasure, as std::erase and std::erase_if, in
+/// one compaction pass through BasicArrayList::erase_if.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy, class U>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::size_type erase(BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>& list, const U& value);
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy, class Predicate>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::size_type erase_if(BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>& list, Predicate pred);
+
+/// ----------------------------------------------------------------------
+/// @function operator<<  </! Stream Insertion Operator !/>
+/// @param    output      Output stream where data is sent
+/// @param    list        Object of the class
+/// @return   Allows objects to be formatted and sent to output streams.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+std::ostream& operator<<(std::ostream& output, const BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>& list);
+
+// =======================================================================
+//                      D E F I N I T I O N S
+// =======================================================================
+
+/// ----------------------------------------------------------------------
+/// @function operator[]
+/// @param    index  holds the position of the element you want to access
+/// @return   Returns a reference as an array element
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::reference BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::operator[](size_type index)
+{
+    CheckPolicy::check_subscript(index < size());
+    return *(m_data + index);
+}
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::const_reference BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::operator[](size_type index) const
+{
+    CheckPolicy::check_subscript(index < size());
+    return *(m_data + index);
+}
+
+/// ----------------------------------------------------------------------
+/// @function BasicArrayList
+/// @param count    holds the number of elements to construct
+/// @param alloc    holds the allocator used for all the storage
+/// @note Constructs an ArrayList with count copies of the default value
+/// of value_type, e.g., the default value for an int is 0.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::BasicArrayList(size_type count, const allocator_type& alloc)
+: BasicArrayList(alloc)
+{
+    // the delegated constructor has completed, so the destructor
+    // releases the storage if a constructor throws
+    reserve(count);
+    
+    uninitialized_value_construct(m_data, m_data + count);
+    m_size = count;
+}
+
+/// ----------------------------------------------------------------------
+/// @function BasicArrayList  </! Copy Constructor !/>
+/// @param    other    holds a reference to other ArrayList
+/// @param    alloc    holds the allocator used for all the storage
+/// @note     Makes a deep copy of another ArrayList.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::BasicArrayList(const BasicArrayList& other, const allocator_type& alloc)
+: BasicArrayList(alloc)
+{
+    reserve(other.size());
+    
+    uninitialized_copy(other.m_data, other.m_data + other.m_size, m_data);
+    m_size = other.size();
+}
+
+/// ----------------------------------------------------------------------
+/// @function BasicArrayList
+/// @param    other     holds the state of another object being moved
+/// @param    alloc     holds the allocator used for all the storage
+/// @note Takes over other's storage when 'alloc' compares equal to its
+/// allocator, otherwise move-constructs the elements one by one.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::BasicArrayList(BasicArrayList&& other, const allocator_type& alloc)
+: BasicArrayList(alloc)
+{
+    if (m_alloc == other.m_alloc)
+    {
+        take_storage(other);
+    }
+    else
+    {
+        reserve(other.size());
+        
+        uninitialized_copy(std::make_move_iterator(other.m_data),
+                           std::make_move_iterator(other.m_data + other.m_size), m_data);
+        m_size = other.size();
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function BasicArrayList
+/// @param    source   Holds initializer list of elements
+/// @param    alloc    holds the allocator used for all the storage
+/// @note     Constructs a container with a copy of the source elements.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::BasicArrayList(const std::initializer_list<T>& source,
+                                                 const allocator_type& alloc)
+: BasicArrayList(alloc)
+{
+    reserve(source.size());
+    
+    uninitialized_copy(source.begin(), source.end(), m_data);
+    m_size = source.size();
+}
+
+/// ----------------------------------------------------------------------
+/// @function ~BasicArrayList  </! Deconstructor !/>
+///
+/// @note Releases any resources the object aquired over its lifetime.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::~BasicArrayList()
+{
+    destroy(m_data, m_data + m_size);
+    deallocate(m_data, m_capacity);
+}
+
+/// ----------------------------------------------------------------------
+/// @function front
+///
+/// @return Returns a reference to the first element in the container.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::reference BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::front() {
+    CheckPolicy::check(size() != 0);
+    return *begin();
+    
+}
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::const_reference BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::front() const
+{
+    CheckPolicy::check(size() != 0);
+    return *begin();
+}
+
+/// ----------------------------------------------------------------------
+/// @function at
+/// @param    pos     Zero-based index of the element to access
+/// @return   Returns a reference to an element at the specified position.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::reference BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::at(size_type pos)
+{
+    CheckPolicy::check(pos < size());
+    
+    return *(m_data + pos);
+}
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::const_reference BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::at(size_type pos) const
+{
+    CheckPolicy::check(pos < size());
+    
+    return *(m_data + pos);
+}
+
+/// ----------------------------------------------------------------------
+/// @function clear
+///
+/// @note Destroys every element and resets the size of the container to 0.
+/// Doesn't deallocate memory, the capacity is left unchanged.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+void BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::clear()
+{
+    destroy(m_data, m_data + m_size);
+    m_size = 0;
+}
+
+/// ----------------------------------------------------------------------
+/// @function push_back
+///
+/// @param    value    holds the 'value' to append
+/// @note Appends the given element value to the end of the container.
+/// If the new size() is greater than capacity(), reallocation occurs.
+/// ----------------------------------------------------------------------
+    
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+void BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::push_back(const value_type& value)
+{
+    emplace_back(value);
+}
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+void BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::push_back(value_type&& value)
+{
+    emplace_back(std::move(value));
+}
+
+/// ----------------------------------------------------------------------
+/// @function emplace_back
+/// @param    args     holds the arguments forwarded to the constructor
+/// @return   Returns a reference to the new element.
+/// @note Constructs a new element in place at the end of the container.
+/// If the new size() is greater than capacity(), reallocation occurs.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+template <class... Args>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::reference BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::emplace_back(Args&&... args)
+{
+    // checks if arraylist size has reached capacity
+    if (size() == capacity())
+    {
+        // grows the storage and constructs the element in a single pass
+        realloc_insert(size(), std::forward<Args>(args)...);
+    }
+    else
+    {
+        // constructs the element in the first unused slot
+        construct(m_data + m_size, std::forward<Args>(args)...);
+        ++m_size;
+    }
+    return *(m_data + m_size - 1);
+}
+
+/// ----------------------------------------------------------------------
+/// @function insert
+/// @param    pos        holds the position to be inserted to
+/// @param    value    holds the new element to be inserted
+/// @return   Returns an iterator pointing to the newly inserted element.
+/// @note     Inserts the new element 'value', at the iterator 'pos'.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::iterator
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::insert(const_iterator pos, const value_type& value)
+{
+    return emplace(pos, value);
+}
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::iterator
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::insert(const_iterator pos, value_type&& value)
+{
+    return emplace(pos, std::move(value));
+}
+
+/// ----------------------------------------------------------------------
+/// @function emplace
+/// @param    pos      holds the position to be inserted to
+/// @param    args     holds the arguments forwarded to the constructor
+/// @return   Returns an iterator pointing to the new element.
+/// @note     Constructs a new element in place, at the iterator 'pos'.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+template <class... Args>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::iterator
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::emplace(const_iterator pos, Args&&... args)
+{
+    CheckPolicy::check(pos >= cbegin() && pos <= cend());
+    
+    const auto offset = static_cast<size_type>(pos - cbegin());
+    
+    // reallocate if necessary
+    if (size() == capacity()) {
+        realloc_insert(offset, std::forward<Args>(args)...);
+        return iterator(m_data + offset);
+    }
+    
+    if (offset == size()) {
+        construct(m_data + m_size, std::forward<Args>(args)...);
+        ++m_size;
+        return iterator(m_data + offset);
+    }
+    
+    // the arguments may refer to an element that is about to be shifted
+    value_type temp(std::forward<Args>(args)...);
+    StatsPolicy::on_insert_shift(m_size - offset);
+    
+    if constexpr (is_trivially_relocatable_v<value_type> &&
+                  std::is_nothrow_move_constructible_v<value_type>)
+    {
+        // shift the tail one to the right in a single block move,
+        // then construct the new value in the vacated slot
+        std::memmove(static_cast<void*>(m_data + offset + 1),
+                     static_cast<const void*>(m_data + offset),
+                     (m_size - offset) * sizeof(value_type));
+        construct(m_data + offset, std::move(temp));
+        ++m_size;
+    }
+    else
+    {
+        // the last element is moved into the unused slot,
+        // the rest are shifted one to the right over live elements
+        construct(m_data + m_size, std::move(*(m_data + m_size - 1)));
+        ++m_size;
+        std::move_backward(m_data + offset, m_data + m_size - 2, m_data + m_size - 1);
+        
+        // insert new value
+        *(m_data + offset) = std::move(temp);
+    }
+    
+    return iterator(m_data + offset);
+}
+
+/// ----------------------------------------------------------------------
+/// @function erase
+/// @param    pos  holds the position to be erased
+/// @return   Returns an iterator pointing to the element immediately
+///           following the erased element.
+/// @note Removes the element at the position indicated by the iterator.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::iterator
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::erase(const_iterator pos)
+{
+    CheckPolicy::check(pos >= cbegin() && pos < cend());
+    
+    return erase(pos, pos + 1);
+}
+
+/// ----------------------------------------------------------------------
+/// @function erase
+/// @param    first  holds the first element to be erased
+/// @param    last   holds one past the last element to be erased
+/// @return   Returns an iterator pointing to the element that followed
+///           the erased range.
+/// @note Removes the elements in [first, last), shifting the tail once.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::iterator
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::erase(const_iterator first, const_iterator last)
+{
+    CheckPolicy::check(first >= cbegin() && last <= cend() && first <= last);
+    
+    const auto offset = static_cast<size_type>(first - cbegin());
+    const auto count  = static_cast<size_type>(last - first);
+    
+    if (count == 0)
+    {
+        return iterator(m_data + offset);
+    }
+    
+    StatsPolicy::on_erase_shift(m_size - offset - count);
+    
+    if constexpr (is_trivially_relocatable_v<value_type>)
+    {
+        // destroy the range, then close the gap in a single block move
+        destroy(m_data + offset, m_data + offset + count);
+        std::memmove(static_cast<void*>(m_data + offset),
+                     static_cast<const void*>(m_data + offset + count),
+                     (m_size - offset - count) * sizeof(value_type));
+        m_size -= count;
+    }
+    else
+    {
+        // shuffle elements right of the range to the left
+        std::move(m_data + offset + count, m_data + m_size, m_data + offset);
+        
+        // destroy the vacated slots at the end
+        destroy(m_data + m_size - count, m_data + m_size);
+        m_size -= count;
+    }
+    
+    return iterator(m_data + offset);
+}
+
+/// ----------------------------------------------------------------------
+/// @function swap_remove
+/// @param    pos  holds the position to be erased
+/// @return   Returns an iterator to the same position, which now holds the
+///           former last element, or end() if pos was the last element.
+/// @note Removes the element in O(1) by moving the last element into its
+/// place. The order of the remaining elements is not kept.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::iterator
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::swap_remove(const_iterator pos)
+{
+    CheckPolicy::check(pos >= cbegin() && pos < cend());
+    
+    const auto offset = static_cast<size_type>(pos - cbegin());
+    pointer    hole   = m_data + offset;
+    pointer    last   = m_data + m_size - 1;
+    
+    if constexpr (is_trivially_relocatable_v<value_type>)
+    {
+        // the hole takes the last element's bytes directly
+        destroy(hole, hole + 1);
+        if (hole != last)
+        {
+            std::memcpy(static_cast<void*>(hole), static_cast<const void*>(last), sizeof(value_type));
+        }
+    }
+    else
+    {
+        if (hole != last)
+        {
+            *hole = std::move(*last);
+        }
+        destroy(last, last + 1);
+    }
+    m_size -= 1;
+    
+    return iterator(m_data + offset);
+}
+
+/// ----------------------------------------------------------------------
+/// @function erase_if
+/// @param    pred     holds the predicate selecting elements to remove
+/// @return   Returns the number of elements removed.
+/// @note Removes every element for which pred returns true, keeping the
+/// order of the rest. The survivors are compacted in a single pass and
+/// the vacated tail is destroyed once, O(n) however many are removed.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+template <class Predicate>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::size_type
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::erase_if(Predicate pred)
+{
+    pointer last  = m_data + m_size;
+    pointer write = std::find_if(m_data, last, pred);
     
-    void swap(ArrayList& other);
+    if (write == last)
+    {
+        return 0;
+    }
     
-    /// ----------------------------------------------------------------------
-    /// @function operator=  </Move Assignment Operator/>
-    /// @param    other     holds contents of source container
-    /// @return   Transfers assets from source object to target object using move semantics
-    /// @return *this
-    /// ----------------------------------------------------------------------
+    const pointer first_match = write;
     
-    ArrayList& operator=(ArrayList&& other);
+    // move each survivor straight to its final slot
+    for (pointer read = write + 1; read != last; ++read)
+    {
+        if (!pred(std::as_const(*read)))
+        {
+            *write = std::move(*read);
+            ++write;
+        }
+    }
     
-    /// ----------------------------------------------------------------------
-    /// @function operator=   </Copy Assignment Operator/>
-    /// @param     rhs          holds contents of other container
-    /// @return  Replaces the contents of the container
-    ///          with a copy of the contents of rhs
-    /// @return *this
-    /// ----------------------------------------------------------------------
+    // only the survivors past the first match moved, as with range erase
+    const auto removed = static_cast<size_type>(last - write);
+    StatsPolicy::on_erase_shift(static_cast<size_type>(last - first_match) - removed);
+    destroy(write, last);
+    m_size -= removed;
     
-    ArrayList& operator=(const ArrayList& rhs);
+    return removed;
+}
+
+/// ----------------------------------------------------------------------
+/// @function insert
+/// @param    pos      holds the position to be inserted to
+/// @param    count    holds the number of copies to insert
+/// @param    value    holds the value to copy
+/// @return   Returns an iterator pointing to the first inserted element.
+/// @note     Inserts 'count' copies of 'value' at the iterator 'pos'.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::iterator
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::insert(const_iterator pos, size_type count, const value_type& value)
+{
+    CheckPolicy::check(pos >= cbegin() && pos <= cend());
     
-    /// ----------------------------------------------------------------------
-    /// @function operator+=
-    /// @param other    holds other contents to be appended
-    /// @return Appends the contents of other to the contianer.
-    /// ----------------------------------------------------------------------
+    const auto offset = static_cast<size_type>(pos - cbegin());
     
-    ArrayList& operator+=(const ArrayList& other);
+    // value may refer to an element that is about to be shifted
+    const value_type copy(value);
+    insert_counted(offset, detail::RepeatIterator<value_type>(copy), count);
     
-    /// ----------------------------------------------------------------------
-    /// @function operator[]
-    /// @param    index  holds the position of the element you want to access
-    /// @return   Returns a reference as an array element
-    /// ----------------------------------------------------------------------
-    reference operator[](size_type index);
-    const_reference operator[](size_type index) const;
+    return iterator(m_data + offset);
+}
+
+/// ----------------------------------------------------------------------
+/// @function insert_range
+/// @param    pos      holds the position to be inserted to
+/// @param    range    holds the elements to insert
+/// @return   Returns an iterator pointing to the first inserted element.
+/// @note Inserts a copy of the elements of range at the iterator 'pos'.
+/// Forward ranges are inserted with at most one reallocation and a
+/// single shift of the tail. Single-pass ranges are appended, then
+/// rotated into place.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+template <std::ranges::input_range R>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::iterator
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::insert_range(const_iterator pos, R&& range)
+{
+    CheckPolicy::check(pos >= cbegin() && pos <= cend());
     
-protected:
-    size_type m_capacity;  ///< The number of elements that can be stored.
-    size_type m_size;      ///< The number of elements in use.
-    pointer   m_data;      ///< Dynamically-allocated array custodian.
-};  // ArrayList class
+    const auto offset = static_cast<size_type>(pos - cbegin());
+    
+    if constexpr (std::ranges::forward_range<R>)
+    {
+        insert_counted(offset, std::ranges::begin(range),
+                       static_cast<size_type>(std::ranges::distance(range)));
+    }
+    else
+    {
+        // the length is unknown up front, append and rotate into place
+        const size_type old_size = size();
+        
+        for (auto&& item : range)
+        {
+            emplace_back(std::forward<decltype(item)>(item));
+        }
+        std::rotate(m_data + offset, m_data + old_size, m_data + m_size);
+    }
+    
+    return iterator(m_data + offset);
+}
 
-//! *********************** Operator Overloads *********************** !//
+/// ----------------------------------------------------------------------
+/// @function assign_range
+/// @param    range    holds the elements to copy
+/// @note Replaces the contents with a copy of the elements of range. The
+/// existing elements and storage are reused where possible, with at most
+/// one reallocation for forward ranges.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+template <std::ranges::input_range R>
+void BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::assign_range(R&& range)
+{
+    if constexpr (std::ranges::forward_range<R>)
+    {
+        assign_counted(std::ranges::begin(range),
+                       static_cast<size_type>(std::ranges::distance(range)));
+    }
+    else
+    {
+        clear();
+        
+        for (auto&& item : range)
+        {
+            emplace_back(std::forward<decltype(item)>(item));
+        }
+    }
+}
 
 /// ----------------------------------------------------------------------
-/// @function operator==    </! Equality Comparison Operator !/>
-/// @param    lhs        -Left-hand side dynamic array
-/// @param    rhs        -Right-hand side dynamic array
-/// @return   Returns true if lhs 'does' compare equal to rhs, else false.
+/// @function resize
+/// @param    count    holds the new size of the desired container
+/// @note Resizes the container to the specified 'count'. If the current
+/// size is greater than 'count', the container is reduced to its first
+/// 'count' elements. If the current size is less than count, additional
+/// default-constructed elements are appended. Reallocation only occurs
+/// when 'count' is greater than capacity().
 /// ----------------------------------------------------------------------
 
-template <class T>
-bool operator==(const ArrayList<T>& lhs, const ArrayList<T>& rhs);
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+void BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::resize(size_type count)
+{
+    if (count < size())
+    {
+        // destroy the elements past the new size
+        destroy(m_data + count, m_data + m_size);
+        m_size = count;
+    }
+    else if (count > size())
+    {
+        if (count > capacity())
+        {
+            reallocate(next_capacity(count));
+        }
+        
+        // default-construct the appended elements
+        uninitialized_value_construct(m_data + m_size, m_data + count);
+        m_size = count;
+    }
+}
 
 /// ----------------------------------------------------------------------
-/// @function operator!=    </! Inequality Comparison Operator !/>
-/// @param    lhs        -Left-hand side dynamic array
-/// @param    rhs        -Right-hand side dynamic array
-/// @return   Returns true if lhs is not equal to rhs, else false.
+/// @function reserve
+/// @param    new_capacity    holds the minimum capacity to make room for
+/// @note Increases the capacity to at least 'new_capacity', reallocating
+/// once. Does nothing if the capacity is already large enough.
 /// ----------------------------------------------------------------------
 
-template <class T>
-bool operator!=(const ArrayList<T>& lhs, const ArrayList<T>& rhs);
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+void BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::reserve(size_type new_capacity)
+{
+    if (new_capacity > capacity())
+    {
+        reallocate(new_capacity);
+    }
+}
 
 /// ----------------------------------------------------------------------
-/// @function operator+   </! Concatenation Operator !/>
-/// @param    lhs    -Left-hand side dynamic array
-/// @param    rhs    -Right-hand side dynamic array
-/// @return   Returns the concatenated elements of lhs and rhs.
+/// @function shrink_to_fit
+///
+/// @note Reallocates the storage so that capacity() equals size(),
+/// releasing the unused capacity.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+void BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::shrink_to_fit()
+{
+    if (capacity() > size())
+    {
+        reallocate(size());
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function swap
+/// @param    other   holds a reference to other contianer
+/// @note Exchanges the contents of the container with those of another,
+/// without copying any elements. The allocators are swapped only if they
+/// propagate on swap; otherwise they must compare equal.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+void BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::swap(BasicArrayList& other)
+noexcept(InlineCapacity == 0 || std::is_nothrow_move_constructible_v<T>)
+{
+    if constexpr (InlineCapacity > 0)
+    {
+        // inline elements can't trade places by pointer, so they are moved
+        if (is_inline() || other.is_inline())
+        {
+            BasicArrayList temp(std::move(other));
+            other = std::move(*this);
+            *this = std::move(temp);
+            return;
+        }
+    }
+    
+    // swap contents
+    std::swap(m_capacity, other.m_capacity);
+    std::swap(m_size,     other.m_size);
+    std::swap(m_data,     other.m_data);
+    
+    if constexpr (alloc_traits::propagate_on_container_swap::value)
+    {
+        using std::swap;
+        swap(m_alloc, other.m_alloc);
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function operator=   </Copy Assignment Operator/>
+/// @param    rhs          holds contents of other container
+/// @return  Replaces the contents of the container
+///          with a copy of the contents of rhs
+/// @return *this
+/// @note The allocator is replaced by rhs's allocator if it propagates
+///       on copy assignment.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>& BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::operator=(const BasicArrayList& rhs)
+{
+    if (this != &rhs) {                         // checks for self-assignment
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+            // the storage has to go back to the allocator that provided it
+            if (m_alloc != rhs.m_alloc) {
+                release_storage();
+            }
+            m_alloc = rhs.m_alloc;
+        }
+        
+        // the current storage is reused when rhs fits in it
+        if(capacity() < rhs.size()) {
+            clear();                            // destroys the elements
+            
+            reallocate(rhs.size());             // allocate new memory
+        }
+        // assign over the live elements, then construct or destroy the rest
+        const size_type common = std::min(size(), rhs.size());
+        
+        std::copy(rhs.m_data, rhs.m_data + common, m_data);
+        
+        if (rhs.size() > size()) {
+            uninitialized_copy(rhs.m_data + common, rhs.m_data + rhs.m_size,
+                                    m_data + common);
+        } else {
+            destroy(m_data + rhs.size(), m_data + m_size);
+        }
+        
+        // set m_size to the rhs size
+        m_size = rhs.size();
+    }
+    // return the reference
+    return *this;
+}
+
+/// ----------------------------------------------------------------------
+/// @function find
+/// @param    value    holds the value to search for
+/// @return   Returns an iterator to the first element equal to value,
+///           or end() if there is none.
+/// @note Integer and floating-point elements are compared with the
+/// widest vector unit the CPU supports.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::iterator
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::find(const value_type& value)
+{
+    return iterator(m_data + detail::find_index(m_data, size(), value));
+}
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::const_iterator
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::find(const value_type& value) const
+{
+    return const_iterator(m_data + detail::find_index(m_data, size(), value));
+}
+
+/// ----------------------------------------------------------------------
+/// @function count
+/// @param    value    holds the value to count
+/// @return   Returns the number of elements equal to value.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::size_type
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::count(const value_type& value) const
+{
+    return detail::count_equal(m_data, size(), value);
+}
+
+/// ----------------------------------------------------------------------
+/// @function index_of
+/// @param    value    holds the value to search for
+/// @return   Returns the position of the first element equal to value,
+///           or npos if there is none.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::size_type
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::index_of(const value_type& value) const
+{
+    const size_type index = detail::find_index(m_data, size(), value);
+    return index == size() ? npos : index;
+}
+
+/// ----------------------------------------------------------------------
+/// @function compare
+/// @param    other    holds the container to compare with
+/// @return   Returns a negative value, 0 or a positive value when the
+///           container orders lexicographically before, equal to or after
+///           other.
+/// @note The first position where the elements aren't == decides, using
+/// operator<; otherwise the shorter container orders first.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+int BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::compare(const BasicArrayList& other) const
+{
+    const size_type common = std::min(size(), other.size());
+    const size_type index  = detail::mismatch_index(m_data, other.m_data, common);
+    
+    if (index < common)
+    {
+        return m_data[index] < other.m_data[index] ? -1 : 1;
+    }
+    if (size() == other.size())
+    {
+        return 0;
+    }
+    return size() < other.size() ? -1 : 1;
+}
+
+/// ----------------------------------------------------------------------
+/// @function write_to
+/// @param    output   holds the stream to write to
+/// @return   Returns output.
+/// @note Writes a SerialHeader followed by the elements. Trivially
+/// copyable elements are written straight from the storage in a single
+/// call; other elements go through serializer<T>.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+std::ostream& BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::write_to(std::ostream& output) const
+{
+    detail::SerialHeader header;
+    header.element_size = detail::SerialHeader::element_size_of<T>();
+    header.count        = size();
+    
+    unsigned char bytes[detail::SerialHeader::size];
+    header.encode(bytes);
+    output.write(reinterpret_cast<const char*>(bytes), sizeof bytes);
+    
+    if constexpr (std::is_trivially_copyable_v<T>)
+    {
+        if (!empty())
+        {
+            output.write(reinterpret_cast<const char*>(m_data),
+                         static_cast<std::streamsize>(size() * sizeof(T)));
+        }
+    }
+    else
+    {
+        for (const T& item : *this)
+        {
+            serializer<T>::write(output, item);
+        }
+    }
+    
+    return output;
+}
+
+/// ----------------------------------------------------------------------
+/// @function read_from
+/// @param    input    holds the stream to read from
+/// @return   Returns input.
+/// @note Replaces the contents with a list written by write_to(). Throws
+/// std::runtime_error for data in another format, cut short or too large
+/// to allocate, leaving the container unchanged. Storage grows with the
+/// data read, never ahead of it by more than a megabyte or the elements
+/// already read. Arithmetic elements written with the other byte order
+/// are converted.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+std::istream& BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::read_from(std::istream& input)
+{
+    unsigned char bytes[detail::SerialHeader::size];
+    if (!input.read(reinterpret_cast<char*>(bytes), sizeof bytes))
+    {
+        throw std::runtime_error{ "Input ended inside the ArrayList header!" };
+    }
+    
+    const detail::SerialHeader header = detail::SerialHeader::decode(bytes);
+    header.check<T>();
+    
+    const auto      count = static_cast<size_type>(header.count);
+    const size_type chunk = std::max<size_type>(1, detail::serial_chunk_bytes / sizeof(T));
+    BasicArrayList  temp(m_alloc);
+    
+    try
+    {
+        // the count is untrusted, so storage grows with the data that arrives
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            // read straight into the new storage, no element is built first
+            while (temp.m_size < count)
+            {
+                const size_type done = temp.m_size;
+                const size_type step = std::min(chunk, count - done);
+                if (done + step > temp.capacity())
+                {
+                    temp.reserve(std::min(count, std::max(done + step, 2 * temp.capacity())));
+                }
+                
+                if (!input.read(reinterpret_cast<char*>(temp.m_data + done),
+                                static_cast<std::streamsize>(step * sizeof(T))))
+                {
+                    throw std::runtime_error{ "Input ended inside the ArrayList elements!" };
+                }
+                temp.m_size = done + step;
+            }
+            
+            if (header.byte_order != detail::SerialHeader::native_byte_order)
+            {
+                detail::reverse_bytes(temp.m_data, count);
+            }
+        }
+        else
+        {
+            temp.reserve(std::min(count, chunk));
+            for (size_type index = 0; index < count; ++index)
+            {
+                temp.emplace_back(serializer<T>::read(input));
+            }
+        }
+    }
+    catch (const std::bad_alloc&)
+    {
+        throw std::runtime_error{ "Data holds more elements than fit in memory!" };
+    }
+    catch (const std::length_error&)
+    {
+        throw std::runtime_error{ "Data holds more elements than fit in memory!" };
+    }
+    
+    swap(temp);
+    return input;
+}
+
+/// ----------------------------------------------------------------------
+/// @function ArrayListView
+/// @param    buffer   holds the serialized list, which may be followed
+///                    by other data
+/// @note Throws std::runtime_error when buffer doesn't start with a list
+/// of T in the host's byte order, and std::invalid_argument when the
+/// elements would be misaligned.
 /// ----------------------------------------------------------------------
 
 template <class T>
-ArrayList<T> operator+(const ArrayList<T>& lhs, const ArrayList<T>& rhs);
+ArrayListView<T>::ArrayListView(std::span<const std::byte> buffer)
+{
+    if (buffer.size() < detail::SerialHeader::size)
+    {
+        throw std::runtime_error{ "Buffer ended inside the ArrayList header!" };
+    }
+    
+    const detail::SerialHeader header =
+        detail::SerialHeader::decode(reinterpret_cast<const unsigned char*>(buffer.data()));
+    header.check<T>();
+    
+    if (header.byte_order != detail::SerialHeader::native_byte_order && sizeof(T) > 1)
+    {
+        throw std::runtime_error{ "Data was written with a different byte order!" };
+    }
+    if (header.count > (buffer.size() - detail::SerialHeader::size) / sizeof(T))
+    {
+        throw std::runtime_error{ "Buffer ended inside the ArrayList elements!" };
+    }
+    
+    const std::byte* elements = buffer.data() + detail::SerialHeader::size;
+    if (reinterpret_cast<std::uintptr_t>(elements) % alignof(T) != 0)
+    {
+        throw std::invalid_argument{ "Buffer is misaligned for the element type!" };
+    }
+    
+    m_data = reinterpret_cast<const T*>(elements);
+    m_size = static_cast<size_type>(header.count);
+}
 
 /// ----------------------------------------------------------------------
-/// @function operator<<  </! Stream Insertion Operator !/>
-/// @param    output      Output stream where data is sent
-/// @param    list        Object of the class
-/// @return   Allows objects to be formatted and sent to output streams.
+/// @function operator=  </Move Assignment Operator/>
+/// @param    other      holds contents of source container
+/// @return   Transfers assets from source object to target object using
+///           move semantics.
+/// @note If the allocator doesn't propagate on move assignment and the two
+/// allocators differ, the elements are moved one by one instead.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>& BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::operator=(BasicArrayList&& other)
+noexcept((std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value ||
+          std::allocator_traits<Allocator>::is_always_equal::value) &&
+         (InlineCapacity == 0 || std::is_nothrow_move_constructible_v<T>))
+{
+    if (this != &other) { //< checks for self-assignment
+        
+        if (alloc_traits::propagate_on_container_move_assignment::value ||
+            m_alloc == other.m_alloc)
+        {
+            // release the current contents before taking over other's
+            release_storage();
+            
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+            {
+                m_alloc = std::move(other.m_alloc);
+            }
+            
+            take_storage(other);
+        }
+        else
+        {
+            // other's storage can't be released by this allocator,
+            // so its elements are moved into storage of our own
+            clear();
+            reserve(other.size());
+            
+            uninitialized_copy(std::make_move_iterator(other.m_data),
+                               std::make_move_iterator(other.m_data + other.m_size), m_data);
+            m_size = other.size();
+            other.clear();
+        }
+    }
+  
+    return *this;
+}
+
+/// ----------------------------------------------------------------------
+/// @function operator+=
+/// @param other    holds other contents to be appended
+/// @return Appends the contents of other to the contianer.
 /// ----------------------------------------------------------------------
 
-template <class T>
-std::ostream& operator<<(std::ostream& output, const ArrayList<T>& list);
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>& BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::operator+=(const BasicArrayList& other)
+{
+    // new minimum capacity
+    size_type reqd_size = size() + other.size();
+    
+    // checks to see if the container's capacity
+    // has enough space for the new elements
+    if (capacity() < reqd_size) {
+        reallocate(next_capacity(reqd_size));
+    }
+    // construct copies of other's elements past the end of the container,
+    // reading other's size up front keeps 'list += list' well-defined
+    uninitialized_copy(other.m_data, other.m_data + other.m_size,
+                            m_data + m_size);
+    
+    // set m_used to the number of elements within the array
+    m_size = reqd_size;
 
-// =======================================================================
-//                      D E F I N I T I O N S
-// =======================================================================
+    // return the value
+    return *this;
+}
 
 /// ----------------------------------------------------------------------
-/// @function operator[]
-/// @param    index  holds the position of the element you want to access
-/// @return   Returns a reference as an array element
+/// @function allocate
+/// @param    count    holds the number of elements to make room for
+/// @return   Returns uninitialized storage for 'count' elements, or
+///           nullptr when 'count' is 0.
 /// ----------------------------------------------------------------------
 
-template <class T>
-typename ArrayList<T>::reference ArrayList<T>::operator[](size_type index)
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::pointer BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::allocate(size_type count)
 {
-    return *(m_data + index);
+    if (count == 0)
+    {
+        return nullptr;
+    }
+    
+    pointer data = alloc_traits::allocate(m_alloc, count);
+    StatsPolicy::on_allocate(count * sizeof(value_type));
+    
+    return data;
 }
 
-template <class T>
-typename ArrayList<T>::const_reference ArrayList<T>::operator[](size_type index) const
+/// ----------------------------------------------------------------------
+/// @function deallocate
+/// @param    data     holds storage obtained from allocate()
+/// @param    count    holds the number of elements it was allocated for
+/// @note     Releases the storage, the elements must already be destroyed.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+void BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::deallocate(pointer data, size_type count)
 {
-    return *(m_data + index);
+    // the inline storage isn't the allocator's to release
+    if (data != nullptr && data != inline_data())
+    {
+        alloc_traits::deallocate(m_alloc, data, count);
+        StatsPolicy::on_deallocate(count * sizeof(value_type));
+    }
 }
 
 /// ----------------------------------------------------------------------
-/// @function ArrayList  </! Copy Constructor !/>
-/// @param    other    holds a reference to other ArrayList
-/// @note     Makes a deep copy of another ArrayList.
+/// @function destroy
+/// @param    first    holds the first element to destroy
+/// @param    last     holds one past the last element to destroy
+/// @note     Runs the destructor of every element in [first, last).
 /// ----------------------------------------------------------------------
 
-template <class T>
-ArrayList<T>::ArrayList(const ArrayList& other)
-: ArrayList(other.size())
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+void BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::destroy(pointer first, pointer last)
 {
-    std::copy(other.begin(), other.end(), begin());
+    for (; first != last; ++first)
+    {
+        alloc_traits::destroy(m_alloc, first);
+    }
 }
 
 /// ----------------------------------------------------------------------
-/// @function ArrayList
-/// @param    source   Holds initializer list of elements
-/// @note     Constructs a container with a copy of the source elements.
+/// @function uninitialized_copy
+/// @param    first    holds the first element to copy
+/// @param    last     holds one past the last element to copy
+/// @param    dest     holds the uninitialized destination storage
+/// @return   Returns one past the last element constructed in 'dest'.
+/// @note Constructs copies of [first, last) in 'dest' through the
+/// allocator. If a copy throws, the ones already made are destroyed.
 /// ----------------------------------------------------------------------
 
-template <class T>
-ArrayList<T>::ArrayList(const std::initializer_list<T>& source)
-: ArrayList(source.size())
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+template <class InputIt>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::pointer
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::uninitialized_copy(InputIt first, InputIt last, pointer dest)
 {
-    std::(source.begin(), source.end(), begin());
+    if constexpr (uses_std_allocator)
+    {
+        return std::uninitialized_copy(first, last, dest);
+    }
+    else
+    {
+        pointer current = dest;
+        
+        try {
+            for (; first != last; ++first, ++current)
+            {
+                construct(current, *first);
+            }
+        } catch (...) {
+            destroy(dest, current);
+            throw;
+        }
+        return current;
+    }
 }
 
 /// ----------------------------------------------------------------------
-/// @function front
-///
-/// @return Returns a reference to the first element in the container.
+/// @function uninitialized_value_construct
+/// @param    first    holds the first slot to construct in
+/// @param    last     holds one past the last slot to construct in
+/// @note Value-initializes every element in [first, last) through the
+/// allocator. If one throws, the ones already made are destroyed.
 /// ----------------------------------------------------------------------
 
-template <class T>
-typename ArrayList<T>::reference ArrayList<T>::front() {
-    if (size() == 0)
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+void BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::uninitialized_value_construct(pointer first, pointer last)
+{
+    if constexpr (uses_std_allocator)
     {
-        throw std::out_of_range{ "Accessed position is out of range!" };
+        std::uninitialized_value_construct(first, last);
     }
-    return *begin();
-    
-}
-template <class T>
-typename ArrayList<T>::const_reference ArrayList<T>::front() const
-{
-    if (size() == 0)
+    else
     {
-        throw std::out_of_range{ "Accessed position is out of range!" };
+        pointer current = first;
+        
+        try {
+            for (; current != last; ++current)
+            {
+                construct(current);
+            }
+        } catch (...) {
+            destroy(first, current);
+            throw;
+        }
     }
-    return *begin();
 }
 
 /// ----------------------------------------------------------------------
-/// @function at
-/// @param    pos     Zero-based index of the element to access
-/// @return   Returns a reference to an element at the specified position.
+/// @function reallocate
+/// @param    new_capacity    holds the capacity of the new storage
+/// @note Relocates the live elements into new storage of 'new_capacity'
+/// elements and releases the old storage. 'new_capacity' must not be
+/// less than size(). A capacity that fits inline moves the elements
+/// back into the inline storage.
 /// ----------------------------------------------------------------------
 
-template <class T>
-typename ArrayList<T>::reference ArrayList<T>::at(size_type pos)
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+void BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::reallocate(size_type new_capacity)
 {
-    if (pos > size() || pos == size())
+    pointer temp = inline_data();
+    
+    if (new_capacity > InlineCapacity)
+    {
+        temp = allocate(new_capacity);
+    }
+    else if (is_inline())
     {
-        throw std::out_of_range{ "Accessed position is out of range!" };
+        // the elements already live in the inline storage
+        return;
+    }
+    else
+    {
+        new_capacity = InlineCapacity;
     }
     
-    return *(m_data + pos);
+    try {
+        relocate(m_data, m_data + m_size, temp);
+    } catch (...) {
+        deallocate(temp, new_capacity);
+        throw;
+    }
+    
+    destroy_relocated(m_data, m_data + m_size);
+    deallocate(m_data, m_capacity);
+    StatsPolicy::on_reallocate(m_capacity, new_capacity);
+    
+    m_data     = temp;
+    m_capacity = new_capacity;
 }
 
-template <class T>
-typename ArrayList<T>::const_reference ArrayList<T>::at(size_type pos) const
+/// ----------------------------------------------------------------------
+/// @function take_storage
+/// @param    other    holds the container whose contents are taken over
+/// @note Takes over other's heap storage, or relocates its inline
+/// elements, leaving other empty. *this must be empty and hold no heap
+/// storage, and the allocators must compare equal.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+void BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::take_storage(BasicArrayList& other)
+noexcept(InlineCapacity == 0 || std::is_nothrow_move_constructible_v<T>)
 {
-    if (pos > size() || pos == size())
+    if constexpr (InlineCapacity > 0)
     {
-        throw std::out_of_range{ "Accessed position is out of range!" };
+        if (other.is_inline())
+        {
+            relocate(other.m_data, other.m_data + other.m_size, m_data);
+            destroy_relocated(other.m_data, other.m_data + other.m_size);
+            m_size = std::exchange(other.m_size, 0);
+            return;
+        }
     }
     
-    return *(m_data + pos);
+    m_capacity = std::exchange(other.m_capacity, InlineCapacity);
+    m_size     = std::exchange(other.m_size, 0);
+    m_data     = std::exchange(other.m_data, other.inline_data());
 }
 
 /// ----------------------------------------------------------------------
-/// @function push_back
+/// @function release_storage
 ///
-/// @param    value    holds the 'value' to append
-/// @note Appends the given element value to the end of the container.
-/// If the new size() is greater than capacity(), reallocation occurs.
+/// @note Destroys the elements, frees any heap storage and returns the
+/// container to the empty state of a default-constructed one.
 /// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+void BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::release_storage() noexcept
+{
+    destroy(m_data, m_data + m_size);
+    deallocate(m_data, m_capacity);
     
-template <class T>
-void ArrayList<T>::push_back(const value_type& value)
+    m_data     = inline_data();
+    m_capacity = InlineCapacity;
+    m_size     = 0;
+}
+
+/// ----------------------------------------------------------------------
+/// @function realloc_insert
+/// @param    index    holds the position of the new element
+/// @param    args     holds the arguments forwarded to the constructor
+/// @note Grows the storage and constructs the new element at 'index'
+/// while the live elements are relocated across. The new element is built
+/// first, since the arguments may refer to an element of the old storage.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+template <class... Args>
+void BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::realloc_insert(size_type index, Args&&... args)
 {
-    // checks if arraylist size has reached capacity
-    if (size() == capacity())
-    {
-        // temporary array
-        pointer temp{};
-        
-        // compute new capacity
-        m_capacity  = capacity() == 0 ? 1 : m_capacity * 2;
-        temp        = new value_type[m_capacity]{};     // allocate temp array
-        
-        // copies over elements to tmp array
-        std::copy(begin(), end(), temp);
-        
-        // reallocate memory
-        delete [] m_data;
-        
-        // sets m_data to new arraylist
-        m_data = temp;
-    }
-    // appends value to array list
-    *(m_data + m_size++) = value;
+    realloc_gap(index, 1, [&](pointer gap) {
+        construct(gap, std::forward<Args>(args)...);
+    });
 }
 
 /// ----------------------------------------------------------------------
-/// @function insert
-/// @param    pos        holds the position to be inserted to
-/// @param    value    holds the new element to be inserted
-/// @return   Returns an iterator pointing to the newly inserted element.
-/// @note     Inserts the new element 'value', at the iterator 'pos'.
+/// @function realloc_gap
+/// @param    index           holds the position of the first new element
+/// @param    count           holds the number of new elements
+/// @param    construct_gap   holds a callable that builds the new elements
+/// @note Grows the storage to fit 'count' more elements. construct_gap is
+/// called with the uninitialized slot at 'index' and must construct all
+/// 'count' elements or none, before the live elements are relocated around
+/// the gap, since the new elements may be copied from the old storage.
 /// ----------------------------------------------------------------------
 
-template <class T>
-typename ArrayList<T>::iterator
-ArrayList<T>::insert(iterator pos, const value_type& value)
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+template <class ConstructGap>
+void BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::realloc_gap(size_type index, size_type count, ConstructGap&& construct_gap)
 {
-    iterator z = end();
+    // compute new capacity
+    const size_type new_capacity = next_capacity(size() + count);
+    pointer temp = allocate(new_capacity);
     
-    if (pos < iterator(m_data))
-    {
-        throw std::out_of_range{ "Accessed position is out of range!" };
+    try {
+        construct_gap(temp + index);
+    } catch (...) {
+        deallocate(temp, new_capacity);
+        throw;
     }
     
-    if (pos > iterator(m_data + m_size))
-    {
-        throw std::out_of_range{ "Accessed position is out of range!" };
-    }
+    // [first, last) tracks the constructed part of temp
+    pointer first = temp + index;
+    pointer last  = first + count;
     
-    // reallocate if necessary
-    if (size() == capacity()) {
-        const auto offset   = std::distance(begin(), pos); // index of pos
-        auto new_capacity   = capacity() == 0 ? 1 : capacity() * 2;
-        auto temp           = new value_type[new_capacity]{};   // temp array
-        
-        std::copy(begin(), end(), temp);
-        
-        delete [] m_data;
-        m_data = temp;
-        m_capacity = new_capacity;
-        pos = iterator(m_data + offset); // reacquire pos
+    try {
+        relocate(m_data, m_data + index, temp);
+        first = temp;
+        last  = relocate(m_data + index, m_data + m_size, last);
+    } catch (...) {
+        destroy(first, last);
+        deallocate(temp, new_capacity);
+        throw;
     }
     
-    std::copy_backward(pos, z, ++z);
-    
-    // insert new value and update size
-    *pos = value;
-    ++m_size;
+    destroy_relocated(m_data, m_data + m_size);
+    deallocate(m_data, m_capacity);
+    StatsPolicy::on_reallocate(m_capacity, new_capacity);
     
-    return pos;
+    m_data     = temp;
+    m_capacity = new_capacity;
+    m_size    += count;
 }
 
 /// ----------------------------------------------------------------------
-/// @function erase
-/// @param    pos  holds the position to be erased
-/// @return   Returns an iterator pointing to the element immediately
-///           following the erased element.
-/// @note Removes the element at the position indicated by the iterator.
+/// @function insert_counted
+/// @param    index    holds the position of the first new element
+/// @param    first    holds the first element to copy
+/// @param    count    holds the number of elements to copy
+/// @note Inserts copies of the 'count' elements starting at 'first' with
+/// at most one reallocation and one shift of the tail.
 /// ----------------------------------------------------------------------
 
-template <class T>
-typename ArrayList<T>::iterator ArrayList<T>::erase(iterator pos)
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+template <class ForwardIt>
+void BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::insert_counted(size_type index, ForwardIt first, size_type count)
 {
-    if (pos < iterator(m_data) || pos == iterator(m_data))
+    if (count == 0)
     {
-        throw std::out_of_range{ "Accessed position is out of range!" };
+        return;
     }
     
-    if (pos > iterator(m_data + m_size))
+    const auto last = std::ranges::next(first, static_cast<difference_type>(count));
+    
+    if (count > capacity() - size())
     {
-        throw std::out_of_range{ "Accessed position is out of range!" };
+        realloc_gap(index, count, [&](pointer gap) {
+            uninitialized_copy(first, last, gap);
+        });
+        return;
     }
     
-    // shuffle elements right of pos to the left
-    std::copy(pos + 1, end(), pos);
+    pointer position = m_data + index;
+    pointer old_end  = m_data + m_size;
+    const size_type elems_after = size() - index;
     
-    --m_size;
+    StatsPolicy::on_insert_shift(elems_after);
     
-    return pos;
+    if constexpr (is_trivially_relocatable_v<value_type>)
+    {
+        // shift the tail right in a single block move and copy into the gap,
+        // moving the tail back if a copy throws
+        std::memmove(static_cast<void*>(position + count),
+                     static_cast<const void*>(position),
+                     elems_after * sizeof(value_type));
+        try {
+            uninitialized_copy(first, last, position);
+        } catch (...) {
+            std::memmove(static_cast<void*>(position),
+                         static_cast<const void*>(position + count),
+                         elems_after * sizeof(value_type));
+            throw;
+        }
+        m_size += count;
+    }
+    else if (elems_after > count)
+    {
+        // the last 'count' elements move into the unused slots,
+        // the rest of the tail shifts over live elements
+        uninitialized_copy(std::make_move_iterator(old_end - count),
+                           std::make_move_iterator(old_end), old_end);
+        m_size += count;
+        std::move_backward(position, old_end - count, old_end);
+        std::copy(first, last, position);
+    }
+    else
+    {
+        // the new elements past the old end and the whole tail
+        // are constructed in unused slots
+        const auto middle = std::ranges::next(first, static_cast<difference_type>(elems_after));
+        pointer built = uninitialized_copy(middle, last, old_end);
+        
+        try {
+            uninitialized_copy(std::make_move_iterator(position),
+                               std::make_move_iterator(old_end), built);
+        } catch (...) {
+            destroy(old_end, built);
+            throw;
+        }
+        m_size += count;
+        std::copy(first, middle, position);
+    }
 }
 
 /// ----------------------------------------------------------------------
-/// @function resize
-/// @param    count    holds the new size of the desired container
-/// @note Resizes the container to the specified 'count'. If the current
-/// size is greater than 'count', the container is reduced to its first
-/// 'count' elements. If the current size is less than count, additional
-/// default-constructed elements are appended.
+/// @function assign_counted
+/// @param    first    holds the first element to copy
+/// @param    count    holds the number of elements to copy
+/// @note Replaces the contents with copies of the 'count' elements
+/// starting at 'first'. The new storage is built before the old one is
+/// released, so the source may be an element of the container.
 /// ----------------------------------------------------------------------
 
-template <class T>
-void ArrayList<T>::resize(size_type count)
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+template <class ForwardIt>
+void BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::assign_counted(ForwardIt first, size_type count)
 {
-    // checks if new size is != current size
-    if (size() != count)
+    const auto last = std::ranges::next(first, static_cast<difference_type>(count));
+    
+    if (count > capacity())
     {
-        // allocate and zero a new array
-        const pointer temp = new value_type[count] {};
+        pointer temp = allocate(count);
         
-        // determine the upper limit of elements to copy
-        //const pointer limit = count < size() ? begin() + count : end();
-        const pointer limit = count < size() ? m_data + count : m_data + m_size;
+        try {
+            uninitialized_copy(first, last, temp);
+        } catch (...) {
+            deallocate(temp, count);
+            throw;
+        }
         
-        std::copy(m_data, limit, temp);
+        StatsPolicy::on_reallocate(m_capacity, count);
+        release_storage();
         
-        delete [] m_data;
-        m_data = temp;
-        m_capacity = m_size = count;
+        m_data     = temp;
+        m_capacity = count;
+        m_size     = count;
+        return;
     }
+    
+    // assign over the live elements, then construct or destroy the rest
+    const size_type common = std::min(size(), count);
+    const auto middle = std::ranges::next(first, static_cast<difference_type>(common));
+    
+    std::copy(first, middle, m_data);
+    
+    if (size() > count)
+    {
+        destroy(m_data + count, m_data + m_size);
+    }
+    else
+    {
+        uninitialized_copy(middle, last, m_data + m_size);
+    }
+    m_size = count;
 }
 
 /// ----------------------------------------------------------------------
-/// @function swap
-/// @param    other   holds a reference to other contianer
-/// @note Exchanges the contents of the container with those of another,
-/// without copying any elements.
-/// ----------------------------------------------------------------------
-
-template <class T>
-void ArrayList<T>::swap(ArrayList& other)
-{
-    // swap contents
-    std::swap(m_capacity, other.m_capacity);
-    std::swap(m_size,     other.m_size);
-    std::swap(m_data,     other.m_data);
-
-}
-
-/// ----------------------------------------------------------------------
-/// @function operator=   </Copy Assignment Operator/>
-/// @param    rhs          holds contents of other container
-/// @return  Replaces the contents of the container
-///          with a copy of the contents of rhs
-/// @return *this
+/// @function relocate
+/// @param    first    holds the first element to relocate
+/// @param    last     holds one past the last element to relocate
+/// @param    dest     holds the uninitialized destination storage
+/// @return   Returns one past the last element constructed in 'dest'.
+/// @note Copies the bytes of trivially relocatable elements. Otherwise
+/// move-constructs the elements into 'dest' when value_type's move
+/// constructor can't throw, or copies them so a failure leaves the
+/// source untouched. The source is released with destroy_relocated().
 /// ----------------------------------------------------------------------
 
-template <class T>
-ArrayList<T>& ArrayList<T>::operator=(const ArrayList& rhs)
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::pointer
+BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::relocate(pointer first, pointer last, pointer dest)
 {
-    if (this != &rhs) {                         // checks for self-assignment
-        if(capacity() != rhs.capacity()) {
-            delete[] m_data;                    // deallocates memory
-            
-            m_data = nullptr;                   // set m_data to nullptr
-            
-            m_capacity = m_size = 0;            // ensures that there is memory
-            
-            m_data = new value_type[rhs.capacity()]{};   // allocate new memory
-            
-            m_capacity = rhs.capacity();  // set m_capacity to the rhs capacity
-        }
-        // replace container with rhs elements
-        std::copy(rhs.begin(), rhs.end(), begin());
+    if constexpr (is_trivially_relocatable_v<value_type>)
+    {
+        const auto count = static_cast<size_type>(last - first);
+        StatsPolicy::on_relocate(count, false);
         
-        // set m_size to the rhs size
-        m_size = rhs.size();
+        // memcpy doesn't accept null pointers, even for an empty range
+        if (count != 0)
+        {
+            std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first),
+                        count * sizeof(value_type));
+        }
+        return dest + count;
     }
-    // return the reference
-    return *this;
-}
-
-/// ----------------------------------------------------------------------
-/// @function operator=  </Move Assignment Operator/>
-/// @param    other      holds contents of source container
-/// @return   Transfers assets from source object to target object using
-///           move semantics.
-/// ----------------------------------------------------------------------
-
-template <class T>
-ArrayList<T>& ArrayList<T>::operator=(ArrayList&& other)
-{
-    if (this != &other) { //< checks for self-assignment
-      
-        m_capacity = std::exchange(other.m_capacity, 0);
-        m_size = std::exchange(other.m_size, 0);
-        m_data = std::exchange(other.m_data, nullptr);
-      
+    // move-only types are moved regardless, as there is nothing to fall back on
+    else if constexpr (std::is_nothrow_move_constructible_v<value_type> ||
+                       !std::is_copy_constructible_v<value_type>)
+    {
+        StatsPolicy::on_relocate(static_cast<size_type>(last - first), false);
+        return uninitialized_copy(std::make_move_iterator(first),
+                                  std::make_move_iterator(last), dest);
+    }
+    else
+    {
+        StatsPolicy::on_relocate(static_cast<size_type>(last - first), true);
+        return uninitialized_copy(first, last, dest);
     }
-  
-    return *this;
 }
 
 /// ----------------------------------------------------------------------
-/// @function operator+=
-/// @param other    holds other contents to be appended
-/// @return Appends the contents of other to the contianer.
+/// @function destroy_relocated
+/// @param    first    holds the first element relocate() read from
+/// @param    last     holds one past the last element relocate() read from
+/// @note Destroys the moved-from source elements. Trivially relocatable
+/// elements already live on in their new storage, so it does nothing.
 /// ----------------------------------------------------------------------
 
-template <class T>
-ArrayList<T>& ArrayList<T>::operator+=(const ArrayList& other)
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+void BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::destroy_relocated(pointer first, pointer last)
 {
-    // new minimum capacity
-    size_type reqd_size = size() + other.size();
-    
-    // checks to see if the container's capacity
-    // has enough space for the new elements
-    if (capacity() < reqd_size) {
-        pointer temp = new value_type[reqd_size];
-        std::copy(begin(), end(), temp);
-        
-        delete [] m_data;
-        m_data = temp;
-        m_capacity = reqd_size;
+    if constexpr (!is_trivially_relocatable_v<value_type>)
+    {
+        destroy(first, last);
     }
-    // creates a temporary dynamic array append other array to the end
-    // of lhs dynamic array
-    std::copy(other.begin(), other.end(), begin() + size());
-    
-    // set m_used to the number of elements within the array
-    m_size += other.m_size;
-
-    // return the value
-    return *this;
 }
 
 /// ----------------------------------------------------------------------
@@ -734,10 +4273,24 @@ ArrayList<T>& ArrayList<T>::operator+=(const ArrayList& other)
 /// @return   Returns true if lhs 'does' compare equal to rhs, else false.
 /// ----------------------------------------------------------------------
 
-template <class T>
-bool operator==(const ArrayList<T>& lhs, const ArrayList<T>& rhs)
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+bool operator==(const BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>& lhs, const BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>& rhs)
 {
-    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    if (lhs.size() != rhs.size())
+    {
+        return false;
+    }
+    
+    if constexpr (is_trivially_equality_comparable_v<T>)
+    {
+        // memcmp doesn't accept null pointers, even for an empty range
+        return lhs.empty() ||
+               std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(T)) == 0;
+    }
+    else
+    {
+        return detail::mismatch_index(lhs.data(), rhs.data(), lhs.size()) == lhs.size();
+    }
 }
 
 /// ----------------------------------------------------------------------
@@ -747,23 +4300,50 @@ bool operator==(const ArrayList<T>& lhs, const ArrayList<T>& rhs)
 /// @return   Returns true if lhs is not equal to rhs, else false.
 /// ----------------------------------------------------------------------
 
-template <class T>
-bool operator!=(const ArrayList<T>& lhs, const ArrayList<T>& rhs)
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+bool operator!=(const BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>& lhs, const BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>& rhs)
 {
     return !(lhs == rhs);
 }
 
 /// ----------------------------------------------------------------------
 /// @function operator+   </! Concatenation Operator !/>
-/// @param    lhs    -Left-hand side dynamic array
-/// @param    rhs    -Right-hand side dynamic array
-/// @return   Returns the concatenated elements of lhs and rhs.
+/// @param    lhs    -Left-hand side list, chain or range
+/// @param    rhs    -Right-hand side list, chain or range
+/// @return   Returns a Concatenation of lhs and rhs, which converts to the
+///           type of the first list operand.
+/// @note One of lhs and rhs must be a list or a chain; the other may be any
+/// forward range of convertible elements, e.g. a std::span.
 /// ----------------------------------------------------------------------
 
-template <class T>
-ArrayList<T> operator+(const ArrayList<T>& lhs, const ArrayList<T>& rhs)
+template <class L, class R>
+requires detail::concat_operands<L, R>
+auto operator+(L&& lhs, R&& rhs)
+{
+    return detail::make_concatenation(std::tuple_cat(detail::concat_parts(std::forward<L>(lhs)),
+                                                     detail::concat_parts(std::forward<R>(rhs))));
+}
+
+/// ----------------------------------------------------------------------
+/// @function erase, erase_if
+/// @param    list     holds the container to remove elements from
+/// @param    value    holds the value of the elements to remove
+/// @param    pred     holds the predicate selecting elements to remove
+/// @return   Returns the number of elements removed.
+/// @note Uniform container erasure, as std::erase and std::erase_if, in
+/// one compaction pass through BasicArrayList::erase_if.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy, class U>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::size_type erase(BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>& list, const U& value)
 {
-    return ArrayList<T>(lhs) += rhs;
+    return list.erase_if([&value](const T& item) { return item == value; });
+}
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy, class Predicate>
+typename BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>::size_type erase_if(BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>& list, Predicate pred)
+{
+    return list.erase_if(std::move(pred));
 }
 
 /// ----------------------------------------------------------------------
@@ -772,14 +4352,30 @@ ArrayList<T> operator+(const ArrayList<T>& lhs, const ArrayList<T>& rhs)
 /// @param    list        Object of the class
 /// @return   Allows objects to be formatted and sent to output streams.
 /// ----------------------------------------------------------------------
-template <class T>
-std::ostream& operator<<(std::ostream& output, const ArrayList<T>& list)
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+std::ostream& operator<<(std::ostream& output, const BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>& list)
 {
+    if constexpr (detail::is_fast_formattable_v<T>)
+    {
+        // same text as the loop below, built in blocks with to_chars
+        if (detail::has_plain_number_format(output))
+        {
+            const int precision = std::is_floating_point_v<T> ? static_cast<int>(output.precision()) : -1;
+            
+            detail::format_elements(list.data(), list.size(), FormatOptions{}, precision,
+                                    [&output](const char* text, std::size_t count) {
+                                        output.write(text, static_cast<std::streamsize>(count));
+                                    },
+                                    [&output](const T& item) { output << item; });
+            return output;
+        }
+    }
+    
     char separator[2]{};
     
     output << '{';
     
-    for (auto item : list) {
+    for (const auto& item : list) {
         output << separator << item;
         *separator = ',';
     }
@@ -791,6 +4387,57 @@ std::ostream& operator<<(std::ostream& output, const ArrayList<T>& list)
 
 } // namespace AL
 
+#if defined(__cpp_lib_format)
+
+/// ----------------------------------------------------------------------
+/// @struct   std::formatter
+/// @note Formats a list as {1,2,3}. The optional specification is the
+/// elision limit, e.g., std::format("{:8}", list) writes at most 8
+/// elements. Elements other than numbers are formatted with "{}".
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+struct std::formatter<AL::BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>, char> {
+    AL::FormatOptions options;
+    
+    constexpr auto parse(std::format_parse_context& context)
+    {
+        auto it = context.begin();
+        if (it != context.end() && *it >= '0' && *it <= '9')
+        {
+            options.max_elements = 0;
+            for (; it != context.end() && *it >= '0' && *it <= '9'; ++it)
+            {
+                options.max_elements = options.max_elements * 10 + static_cast<std::size_t>(*it - '0');
+            }
+        }
+        if (it != context.end() && *it != '}')
+        {
+            throw std::format_error{ "ArrayList format specification must be an element count" };
+        }
+        return it;
+    }
+    
+    template <class FormatContext>
+    auto format(const AL::BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>& list,
+                FormatContext& context) const
+    {
+        auto out = context.out();
+        AL::detail::format_elements(list.data(), list.size(), options, -1,
+                                    [&out](const char* text, std::size_t count) {
+                                        out = std::copy(text, text + count, out);
+                                    },
+                                    [&out](const T& item) { out = std::format_to(out, "{}", item); });
+        return out;
+    }
+};
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t InlineCapacity, class StatsPolicy, class CheckPolicy>
+struct std::formatter<AL::ArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>, char>
+: std::formatter<AL::BasicArrayList<T, GrowthPolicy, Allocator, InlineCapacity, StatsPolicy, CheckPolicy>, char> {};
+
+#endif
+
 #endif /* ArrayList_hpp */
 
 /* EOF */
@@ -0,0 +1,596 @@
+/// @author - Brandon Wallace
+/// @file - ConcurrentArrayList.hpp
+/// @brief - The ConcurrentArrayList lets any number of threads append at
+/// once. Elements never move, so references stay valid while others push,
+/// and freeze() turns the result into a plain ArrayList.
+
+#ifndef ConcurrentArrayList_hpp
+#define ConcurrentArrayList_hpp
+
+/// C++ Standard Library Header Files
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/// User Defined Header Files
+#include "ArrayList.hpp"
+
+namespace AL {
+
+/// ----------------------------------------------------------------------
+/// @class    ConcurrentArrayList
+/// @note Elements live in segments of 32, 64, 128, ... slots that are never
+/// reallocated. push_back claims a slot with a single fetch_add and
+/// constructs the element in place; a thread that finds the slot's segment
+/// missing allocates it and publishes it with a compare-exchange, freeing
+/// its own copy if another thread got there first. No thread ever waits on
+/// another, so appends are wait-free.
+///
+/// push_back, emplace_back, operator[], at, size and capacity may be called
+/// concurrently. An element may be read by any thread that has seen its
+/// push_back return, e.g. through the returned reference or index. Every
+/// other member requires that no other thread uses the container.
+/// ----------------------------------------------------------------------
+
+template <class T>
+class ConcurrentArrayList {
+public:
+    typedef T                 value_type;
+    typedef std::size_t       size_type;
+    typedef std::ptrdiff_t    difference_type;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+
+    template <bool IsConst>
+    class Iterator;
+
+    using iterator       = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    /// ----------------------------------------------------------------------
+    /// @function ConcurrentArrayList  </Default Constructor/>
+    /// @note Allocates nothing until the first element is added.
+    /// ----------------------------------------------------------------------
+
+    ConcurrentArrayList() noexcept = default;
+
+    /// ----------------------------------------------------------------------
+    /// @function ConcurrentArrayList  </Move Constructor/>
+    /// @param    other       holds contents of source container
+    /// @note Takes the segments of other, which is left empty.
+    /// ----------------------------------------------------------------------
+
+    ConcurrentArrayList(ConcurrentArrayList&& other) noexcept;
+
+    ConcurrentArrayList(const ConcurrentArrayList&) = delete;
+    ConcurrentArrayList& operator=(const ConcurrentArrayList&) = delete;
+    ConcurrentArrayList& operator=(ConcurrentArrayList&&) = delete;
+
+    /// ----------------------------------------------------------------------
+    /// @function ~ConcurrentArrayList  </Destructor/>
+    /// ----------------------------------------------------------------------
+
+    ~ConcurrentArrayList();
+
+    //! *** Element Access *** !//
+
+    /// ----------------------------------------------------------------------
+    /// @function at
+    /// @param    index    holds index to specified element
+    /// @return   Returns a reference to the element at the specified index.
+    /// @note Throws std::out_of_range for an index past size() or a slot
+    /// that holds no element, because it is still being constructed or its
+    /// constructor threw.
+    /// ----------------------------------------------------------------------
+
+    reference       at(size_type index);
+    const_reference at(size_type index) const;
+
+    /// ----------------------------------------------------------------------
+    /// @function begin
+    /// @return   Returns an iterator to the first element.
+    /// ----------------------------------------------------------------------
+
+    iterator       begin() noexcept       { return iterator(this, 0, size()); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0, size()); }
+
+    /// ----------------------------------------------------------------------
+    /// @function end
+    /// @return   Returns an iterator past the last element.
+    /// ----------------------------------------------------------------------
+
+    iterator       end() noexcept       { return iterator(this, size(), size()); }
+    const_iterator end() const noexcept { return const_iterator(this, size(), size()); }
+
+    //! *** Capacity *** !//
+
+    /// ----------------------------------------------------------------------
+    /// @function empty
+    /// @return   Returns 'True' if the container is empty.
+    /// ----------------------------------------------------------------------
+
+    bool empty() const noexcept { return size() == 0; }
+
+    /// ----------------------------------------------------------------------
+    /// @function size
+    /// @return   Returns the number of slots claimed by push_back so far.
+    ///           While appends are in flight this includes elements that
+    ///           are still being constructed.
+    /// ----------------------------------------------------------------------
+
+    size_type size() const noexcept { return m_size.load(std::memory_order_acquire); }
+
+    /// ----------------------------------------------------------------------
+    /// @function capacity
+    /// @return   Returns the number of slots in the allocated segments.
+    /// ----------------------------------------------------------------------
+
+    size_type capacity() const noexcept;
+
+    /// ----------------------------------------------------------------------
+    /// @function reserve
+    /// @param    new_cap     holds the minimum capacity
+    /// @note Allocates the segments up front, so that appends below new_cap
+    /// don't allocate. Safe to call while other threads append.
+    /// ----------------------------------------------------------------------
+
+    void reserve(size_type new_cap);
+
+    //! *** Modifiers *** !//
+
+    /// ----------------------------------------------------------------------
+    /// @function clear
+    /// @note Destroys the elements and keeps the segments.
+    /// ----------------------------------------------------------------------
+
+    void clear() noexcept;
+
+    /// ----------------------------------------------------------------------
+    /// @function push_back
+    /// @param    value    holds the value to append
+    /// @return   Returns the index of the new element.
+    /// ----------------------------------------------------------------------
+
+    size_type push_back(const value_type& value) { return claim(value); }
+    size_type push_back(value_type&& value) { return claim(std::move(value)); }
+
+    /// ----------------------------------------------------------------------
+    /// @function emplace_back
+    /// @param    args     holds the arguments to construct the element with
+    /// @return   Returns a reference to the new element.
+    /// @note If the constructor throws, the claimed slot stays empty: it
+    /// still counts towards size(), at() throws for it, and iterators,
+    /// freeze() and the destructor skip it.
+    /// ----------------------------------------------------------------------
+
+    template <class... Args>
+    reference emplace_back(Args&&... args);
+
+    /// ----------------------------------------------------------------------
+    /// @function freeze
+    /// @return   Returns an ArrayList holding the elements in index order.
+    /// @note Moves each element once and frees the segments, leaving this
+    /// container empty.
+    /// ----------------------------------------------------------------------
+
+    ArrayList<T> freeze();
+
+    //! *** Operators *** !//
+
+    /// ----------------------------------------------------------------------
+    /// @function operator[]
+    /// @param    index    holds index to specified element
+    /// @return   Returns a reference to the element at the specified index.
+    /// ----------------------------------------------------------------------
+
+    reference operator[](size_type index) noexcept
+    {
+        return *element(segment_of(index), offset_of(index));
+    }
+
+    const_reference operator[](size_type index) const noexcept
+    {
+        return *element(segment_of(index), offset_of(index));
+    }
+
+private:
+    // a segment holds its slots followed by one state byte per slot
+    enum SlotState : unsigned char { slot_empty, slot_constructed };
+
+    static constexpr size_type first_shift   = 5;
+    static constexpr size_type first_size    = size_type(1) << first_shift;
+    static constexpr size_type max_segments  = std::numeric_limits<size_type>::digits - first_shift;
+    static constexpr std::size_t alignment   = std::max(alignof(T), alignof(std::max_align_t));
+
+    static size_type segment_of(size_type index) noexcept
+    {
+        return std::bit_width(index + first_size) - 1 - first_shift;
+    }
+
+    static size_type offset_of(size_type index) noexcept
+    {
+        return index + first_size - (first_size << segment_of(index));
+    }
+
+    static size_type segment_size(size_type segment) noexcept
+    {
+        return first_size << segment;
+    }
+
+    template <class... Args>
+    size_type claim(Args&&... args);
+
+    std::byte* segment(size_type index);
+    void       free_segment(size_type index) noexcept;
+
+    T* element(size_type segment, size_type offset) const noexcept
+    {
+        return reinterpret_cast<T*>(m_segments[segment].load(std::memory_order_acquire)) + offset;
+    }
+
+    std::atomic<unsigned char>& state(size_type segment, size_type offset) const noexcept
+    {
+        std::byte* base = m_segments[segment].load(std::memory_order_acquire);
+        return reinterpret_cast<std::atomic<unsigned char>*>(base + segment_size(segment) * sizeof(T))[offset];
+    }
+
+    /// Whether the slot at index holds an element, checked by at() and
+    /// the iterators since size() also counts empty slots.
+    bool constructed(size_type index) const noexcept
+    {
+        const size_type seg = segment_of(index);
+        return m_segments[seg].load(std::memory_order_acquire) &&
+               state(seg, offset_of(index)).load(std::memory_order_acquire) == slot_constructed;
+    }
+
+    template <class Function>
+    void for_each_segment(Function&& func);
+
+    std::atomic<size_type>  m_size{ 0 };
+    std::atomic<std::byte*> m_segments[max_segments]{};
+};
+
+/// ----------------------------------------------------------------------
+/// @class    Iterator
+/// @note Forward iterator over the indices [0, size()) seen when it was
+/// created, skipping the slots that hold no element. It never steps past
+/// that bound, and every iterator at its bound compares equal to end(),
+/// so appends by other threads can't carry it past the range.
+/// ----------------------------------------------------------------------
+
+template <class T>
+template <bool IsConst>
+class ConcurrentArrayList<T>::Iterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = std::conditional_t<IsConst, const T*, T*>;
+    using reference         = std::conditional_t<IsConst, const T&, T&>;
+    using container_type    = std::conditional_t<IsConst, const ConcurrentArrayList, ConcurrentArrayList>;
+
+    Iterator() noexcept = default;
+    Iterator(container_type* list, size_type index, size_type end) noexcept
+        : m_list(list), m_index(std::min(index, end)), m_end(end)
+    {
+        skip_empty();
+    }
+
+    operator Iterator<true>() const noexcept requires (!IsConst) { return Iterator<true>(m_list, m_index, m_end); }
+
+    reference operator*() const noexcept { return (*m_list)[m_index]; }
+    pointer   operator->() const noexcept { return &(*m_list)[m_index]; }
+
+    Iterator& operator++() noexcept
+    {
+        if (m_index != m_end)
+        {
+            ++m_index;
+            skip_empty();
+        }
+        return *this;
+    }
+
+    Iterator  operator++(int) noexcept { Iterator temp = *this; ++*this; return temp; }
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept
+    {
+        const bool lhs_done = lhs.m_index == lhs.m_end;
+        const bool rhs_done = rhs.m_index == rhs.m_end;
+        return lhs_done || rhs_done ? lhs_done == rhs_done : lhs.m_index == rhs.m_index;
+    }
+
+private:
+    void skip_empty() noexcept
+    {
+        while (m_index != m_end && !m_list->constructed(m_index))
+        {
+            ++m_index;
+        }
+    }
+
+    container_type* m_list  = nullptr;
+    size_type       m_index = 0;
+    size_type       m_end   = 0;
+};
+
+//! ******************* D E F I N I T I O N S ************************ !//
+
+/// ----------------------------------------------------------------------
+/// @function ConcurrentArrayList  </Move Constructor/>
+/// @param    other       holds contents of source container
+/// @note Takes the segments of other, which is left empty.
+/// ----------------------------------------------------------------------
+
+template <class T>
+ConcurrentArrayList<T>::ConcurrentArrayList(ConcurrentArrayList&& other) noexcept
+    : m_size(other.m_size.exchange(0, std::memory_order_relaxed))
+{
+    for (size_type index = 0; index < max_segments; ++index)
+    {
+        m_segments[index].store(other.m_segments[index].exchange(nullptr, std::memory_order_relaxed),
+                                std::memory_order_relaxed);
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function ~ConcurrentArrayList  </Destructor/>
+/// ----------------------------------------------------------------------
+
+template <class T>
+ConcurrentArrayList<T>::~ConcurrentArrayList()
+{
+    clear();
+    for (size_type index = 0; index < max_segments; ++index)
+    {
+        free_segment(index);
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function at
+/// @param    index    holds index to specified element
+/// @return   Returns a reference to the element at the specified index.
+/// @note Throws std::out_of_range for an index past size() or a slot
+/// that holds no element, because it is still being constructed or its
+/// constructor threw.
+/// ----------------------------------------------------------------------
+
+template <class T>
+typename ConcurrentArrayList<T>::reference
+ConcurrentArrayList<T>::at(size_type index)
+{
+    if (index >= size() || !constructed(index))
+    {
+        throw std::out_of_range{ "Accessed position is out of range!" };
+    }
+    return (*this)[index];
+}
+
+template <class T>
+typename ConcurrentArrayList<T>::const_reference
+ConcurrentArrayList<T>::at(size_type index) const
+{
+    if (index >= size() || !constructed(index))
+    {
+        throw std::out_of_range{ "Accessed position is out of range!" };
+    }
+    return (*this)[index];
+}
+
+/// ----------------------------------------------------------------------
+/// @function capacity
+/// @return   Returns the number of slots in the allocated segments.
+/// ----------------------------------------------------------------------
+
+template <class T>
+typename ConcurrentArrayList<T>::size_type
+ConcurrentArrayList<T>::capacity() const noexcept
+{
+    size_type total = 0;
+    for (size_type index = 0; index < max_segments; ++index)
+    {
+        if (m_segments[index].load(std::memory_order_acquire))
+        {
+            total += segment_size(index);
+        }
+    }
+    return total;
+}
+
+/// ----------------------------------------------------------------------
+/// @function reserve
+/// @param    new_cap     holds the minimum capacity
+/// @note Allocates the segments up front, so that appends below new_cap
+/// don't allocate. Safe to call while other threads append.
+/// ----------------------------------------------------------------------
+
+template <class T>
+void ConcurrentArrayList<T>::reserve(size_type new_cap)
+{
+    if (new_cap == 0)
+    {
+        return;
+    }
+    for (size_type index = 0; index <= segment_of(new_cap - 1); ++index)
+    {
+        segment(index);
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function clear
+/// @note Destroys the elements and keeps the segments.
+/// ----------------------------------------------------------------------
+
+template <class T>
+void ConcurrentArrayList<T>::clear() noexcept
+{
+    for_each_segment([](T* first, std::atomic<unsigned char>* states, size_type count) {
+        for (size_type offset = 0; offset < count; ++offset)
+        {
+            if (states[offset].load(std::memory_order_relaxed) == slot_constructed)
+            {
+                std::destroy_at(first + offset);
+            }
+            states[offset].store(slot_empty, std::memory_order_relaxed);
+        }
+    });
+    m_size.store(0, std::memory_order_release);
+}
+
+/// ----------------------------------------------------------------------
+/// @function emplace_back
+/// @param    args     holds the arguments to construct the element with
+/// @return   Returns a reference to the new element.
+/// @note If the constructor throws, the claimed slot stays empty: it
+/// still counts towards size(), at() throws for it, and iterators,
+/// freeze() and the destructor skip it.
+/// ----------------------------------------------------------------------
+
+template <class T>
+template <class... Args>
+typename ConcurrentArrayList<T>::reference
+ConcurrentArrayList<T>::emplace_back(Args&&... args)
+{
+    return (*this)[claim(std::forward<Args>(args)...)];
+}
+
+/// ----------------------------------------------------------------------
+/// @function freeze
+/// @return   Returns an ArrayList holding the elements in index order.
+/// @note Moves each element once and frees the segments, leaving this
+/// container empty.
+/// ----------------------------------------------------------------------
+
+template <class T>
+ArrayList<T> ConcurrentArrayList<T>::freeze()
+{
+    ArrayList<T> result;
+    result.reserve(size());
+
+    for_each_segment([&result](T* first, std::atomic<unsigned char>* states, size_type count) {
+        for (size_type offset = 0; offset < count; ++offset)
+        {
+            if (states[offset].load(std::memory_order_relaxed) == slot_constructed)
+            {
+                result.emplace_back(std::move(first[offset]));
+                std::destroy_at(first + offset);
+                states[offset].store(slot_empty, std::memory_order_relaxed);
+            }
+        }
+    });
+
+    m_size.store(0, std::memory_order_release);
+    for (size_type index = 0; index < max_segments; ++index)
+    {
+        free_segment(index);
+    }
+    return result;
+}
+
+/// ----------------------------------------------------------------------
+/// @function claim
+/// @param    args     holds the arguments to construct the element with
+/// @return   Returns the index of the slot the element was built in.
+/// ----------------------------------------------------------------------
+
+template <class T>
+template <class... Args>
+typename ConcurrentArrayList<T>::size_type
+ConcurrentArrayList<T>::claim(Args&&... args)
+{
+    const size_type index   = m_size.fetch_add(1, std::memory_order_acq_rel);
+    const size_type seg     = segment_of(index);
+    const size_type offset  = offset_of(index);
+    std::byte*      storage = segment(seg);
+
+    std::construct_at(reinterpret_cast<T*>(storage) + offset, std::forward<Args>(args)...);
+    state(seg, offset).store(slot_constructed, std::memory_order_release);
+    return index;
+}
+
+/// ----------------------------------------------------------------------
+/// @function segment
+/// @param    index    holds index of the segment
+/// @return   Returns the storage of the segment, allocating it first if
+///           no thread has done so yet.
+/// ----------------------------------------------------------------------
+
+template <class T>
+std::byte* ConcurrentArrayList<T>::segment(size_type index)
+{
+    std::byte* current = m_segments[index].load(std::memory_order_acquire);
+    if (current)
+    {
+        return current;
+    }
+
+    const size_type count = segment_size(index);
+    auto* fresh = static_cast<std::byte*>(
+        ::operator new(count * sizeof(T) + count, std::align_val_t{ alignment }));
+
+    auto* states = reinterpret_cast<std::atomic<unsigned char>*>(fresh + count * sizeof(T));
+    std::uninitialized_value_construct_n(states, count);
+
+    if (m_segments[index].compare_exchange_strong(current, fresh, std::memory_order_acq_rel,
+                                                  std::memory_order_acquire))
+    {
+        return fresh;
+    }
+
+    // another thread published the segment first
+    ::operator delete(fresh, std::align_val_t{ alignment });
+    return current;
+}
+
+/// ----------------------------------------------------------------------
+/// @function free_segment
+/// @param    index    holds index of the segment
+/// @note The segment must not hold any elements.
+/// ----------------------------------------------------------------------
+
+template <class T>
+void ConcurrentArrayList<T>::free_segment(size_type index) noexcept
+{
+    if (std::byte* storage = m_segments[index].exchange(nullptr, std::memory_order_acq_rel))
+    {
+        ::operator delete(storage, std::align_val_t{ alignment });
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function for_each_segment
+/// @param    func     holds the callable invoked as func(first, states,
+///                    count) for the used slots of every segment, in order
+/// ----------------------------------------------------------------------
+
+template <class T>
+template <class Function>
+void ConcurrentArrayList<T>::for_each_segment(Function&& func)
+{
+    const size_type used = size();
+
+    for (size_type seg = 0, first = 0; first < used; first += segment_size(seg), ++seg)
+    {
+        if (std::byte* storage = m_segments[seg].load(std::memory_order_acquire))
+        {
+            const size_type count = std::min(segment_size(seg), used - first);
+            func(reinterpret_cast<T*>(storage),
+                 reinterpret_cast<std::atomic<unsigned char>*>(storage + segment_size(seg) * sizeof(T)),
+                 count);
+        }
+    }
+}
+
+} // namespace AL
+
+#endif /* ConcurrentArrayList_hpp */
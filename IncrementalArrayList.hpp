@@ -0,0 +1,614 @@
+/// @author - Brandon Wallace
+/// @file - IncrementalArrayList.hpp
+/// @brief - The IncrementalArrayList grows without an O(n) copy inside a
+/// single push_back: the elements move to the new storage a few at a time,
+/// on the pushes that follow the growth.
+
+#ifndef IncrementalArrayList_hpp
+#define IncrementalArrayList_hpp
+
+/// C++ Standard Library Header Files
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/// User Defined Header Files
+#include "ArrayList.hpp"
+
+namespace AL {
+
+/// ----------------------------------------------------------------------
+/// @class    IncrementalArrayList
+/// @note When a push finds the storage full, new storage is allocated
+/// through GrowthPolicy but the elements stay where they are. That push
+/// and each one after it move at most a bounded number of them, front
+/// first, from the old storage to the new, at least MigrationStep and
+/// enough to be done before the new storage fills. Until then positions
+/// below the migrated count and from the old size up live in the new
+/// storage and the rest in the old, which element access checks for, so
+/// no single push costs more than O(1) element moves.
+///
+/// Iterators are random-access and hold positions, so they survive a
+/// migration; pointers and references to a not yet migrated element are
+/// invalidated by the push that moves it. data() and reserve() finish the
+/// migration first, in O(n).
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy = DoublingGrowth, class Allocator = std::allocator<T>,
+          std::size_t MigrationStep = 2>
+class IncrementalArrayList {
+    static_assert(MigrationStep > 0, "IncrementalArrayList must migrate at least one element per push!");
+
+    template <bool Const>
+    class Iterator;
+
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+public:
+    typedef T                                      value_type;
+    typedef Allocator                              allocator_type;
+    typedef std::size_t                            size_type;
+    typedef std::ptrdiff_t                         difference_type;
+    typedef value_type&                            reference;
+    typedef const value_type&                      const_reference;
+    typedef typename alloc_traits::pointer         pointer;
+    typedef typename alloc_traits::const_pointer   const_pointer;
+    typedef Iterator<false>                        iterator;
+    typedef Iterator<true>                         const_iterator;
+
+    /// ----------------------------------------------------------------------
+    /// @function IncrementalArrayList  </Default Constructor/>
+    /// @param    alloc    holds the allocator used for all the storage
+    /// ----------------------------------------------------------------------
+
+    IncrementalArrayList() noexcept(noexcept(Allocator())) = default;
+    explicit IncrementalArrayList(const allocator_type& alloc) noexcept : m_alloc(alloc) {}
+
+    /// ----------------------------------------------------------------------
+    /// @function IncrementalArrayList
+    /// @param    init_list   holds the elements to copy, front to back
+    /// ----------------------------------------------------------------------
+
+    IncrementalArrayList(std::initializer_list<value_type> init_list, const allocator_type& alloc = allocator_type())
+        : IncrementalArrayList(alloc)
+    {
+        reserve(init_list.size());
+        for (const auto& item : init_list)
+        {
+            push_back(item);
+        }
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @function IncrementalArrayList  </Copy Constructor/>
+    /// @param    other    holds contents of source container
+    /// @note The copy is contiguous, in storage of exactly its size.
+    /// ----------------------------------------------------------------------
+
+    IncrementalArrayList(const IncrementalArrayList& other);
+
+    /// ----------------------------------------------------------------------
+    /// @function IncrementalArrayList  </Move Constructor/>
+    /// @param    other    holds contents of source container
+    /// ----------------------------------------------------------------------
+
+    IncrementalArrayList(IncrementalArrayList&& other) noexcept
+        : m_data(std::exchange(other.m_data, nullptr)),
+          m_capacity(std::exchange(other.m_capacity, 0)),
+          m_size(std::exchange(other.m_size, 0)),
+          m_old(std::exchange(other.m_old, nullptr)),
+          m_old_capacity(std::exchange(other.m_old_capacity, 0)),
+          m_old_size(std::exchange(other.m_old_size, 0)),
+          m_migrated(std::exchange(other.m_migrated, 0)),
+          m_step(other.m_step),
+          m_alloc(std::move(other.m_alloc)) {}
+
+    /// ----------------------------------------------------------------------
+    /// @function ~IncrementalArrayList  </Destructor/>
+    /// ----------------------------------------------------------------------
+
+    ~IncrementalArrayList()
+    {
+        clear();
+        deallocate(m_data, m_capacity);
+    }
+
+    //! *** Element Access *** !//
+
+    /// ----------------------------------------------------------------------
+    /// @function at
+    /// @param    index    holds the position counted from the front
+    /// @return   Returns a reference to the element at the position.
+    /// @note Throws std::out_of_range for an index past size().
+    /// ----------------------------------------------------------------------
+
+    reference at(size_type index)
+    {
+        check_index(index);
+        return (*this)[index];
+    }
+
+    const_reference at(size_type index) const
+    {
+        check_index(index);
+        return (*this)[index];
+    }
+
+    reference       front()       { return at(0); }
+    const_reference front() const { return at(0); }
+    reference       back()        { return at(m_size - 1); }
+    const_reference back() const  { return at(m_size - 1); }
+
+    /// ----------------------------------------------------------------------
+    /// @function data
+    /// @return   Returns a pointer to the contiguous elements.
+    /// @note Finishes a migration in progress first.
+    /// ----------------------------------------------------------------------
+
+    value_type* data()
+    {
+        finish_migration();
+        return std::to_address(m_data);
+    }
+
+    iterator       begin() noexcept        { return iterator(this, 0); }
+    const_iterator begin() const noexcept  { return const_iterator(this, 0); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    iterator       end() noexcept          { return iterator(this, m_size); }
+    const_iterator end() const noexcept    { return const_iterator(this, m_size); }
+    const_iterator cend() const noexcept   { return end(); }
+
+    //! *** Capacity *** !//
+
+    bool      empty() const noexcept    { return m_size == 0; }
+    size_type size() const noexcept     { return m_size; }
+    size_type capacity() const noexcept { return m_capacity; }
+
+    /// ----------------------------------------------------------------------
+    /// @function migrating
+    /// @return   Returns 'True' while some elements are still in the
+    ///           storage from before the last growth.
+    /// ----------------------------------------------------------------------
+
+    bool migrating() const noexcept { return m_migrated != m_old_size; }
+
+    allocator_type get_allocator() const noexcept { return m_alloc; }
+
+    /// ----------------------------------------------------------------------
+    /// @function reserve
+    /// @param    new_capacity    holds the minimum number of elements
+    /// @note Finishes a migration in progress, then relocates the elements
+    /// at once; only a push grows incrementally.
+    /// ----------------------------------------------------------------------
+
+    void reserve(size_type new_capacity)
+    {
+        if (new_capacity > m_capacity)
+        {
+            finish_migration();
+            reallocate(new_capacity);
+        }
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @function finish_migration
+    /// @note Moves the elements left in the old storage and releases it,
+    /// e.g. ahead of a latency-sensitive stretch.
+    /// ----------------------------------------------------------------------
+
+    void finish_migration() { migrate(m_old_size - m_migrated); }
+
+    //! *** Modifiers *** !//
+
+    void clear() noexcept
+    {
+        while (m_size != 0)
+        {
+            pop_back_unchecked();
+        }
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @function push_back
+    /// @param    value    holds the value to append
+    /// ----------------------------------------------------------------------
+
+    void push_back(const value_type& value) { emplace_back(value); }
+    void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+    /// ----------------------------------------------------------------------
+    /// @function emplace_back
+    /// @param    args     holds the arguments to construct the element with
+    /// @return   Returns a reference to the new back element.
+    /// @note Appends, then migrates the next few elements. If moving one of
+    /// those throws the new element stays appended and the exception
+    /// propagates; the elements not moved stay in the old storage.
+    /// ----------------------------------------------------------------------
+
+    template <class... Args>
+    reference emplace_back(Args&&... args);
+
+    /// ----------------------------------------------------------------------
+    /// @function pop_back
+    /// @note Throws std::out_of_range when the container is empty.
+    /// ----------------------------------------------------------------------
+
+    void pop_back()
+    {
+        check_index(0);
+        pop_back_unchecked();
+    }
+
+    void swap(IncrementalArrayList& other) noexcept
+    {
+        using std::swap;
+        swap(m_data, other.m_data);
+        swap(m_capacity, other.m_capacity);
+        swap(m_size, other.m_size);
+        swap(m_old, other.m_old);
+        swap(m_old_capacity, other.m_old_capacity);
+        swap(m_old_size, other.m_old_size);
+        swap(m_migrated, other.m_migrated);
+        swap(m_step, other.m_step);
+        swap(m_alloc, other.m_alloc);
+    }
+
+    //! *** Operators *** !//
+
+    /// ----------------------------------------------------------------------
+    /// @function operator=  </Copy and Move Assignment Operator/>
+    /// @param    other      holds contents of source container
+    /// @return   Returns a reference to this container.
+    /// ----------------------------------------------------------------------
+
+    IncrementalArrayList& operator=(IncrementalArrayList other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    reference       operator[](size_type index) noexcept       { return *location(index); }
+    const_reference operator[](size_type index) const noexcept { return *location(index); }
+
+private:
+    /// Storage of the element at 'index', the old one if not yet migrated.
+    pointer location(size_type index) const noexcept
+    {
+        return index >= m_migrated && index < m_old_size ? m_old + index : m_data + index;
+    }
+
+    void check_index(size_type index) const
+    {
+        if (index >= m_size)
+        {
+            throw std::out_of_range{ "Accessed position is out of range!" };
+        }
+    }
+
+    void pop_back_unchecked() noexcept
+    {
+        alloc_traits::destroy(m_alloc, std::to_address(location(m_size - 1)));
+        --m_size;
+
+        if (m_old_size > m_size)
+        {
+            // the popped element was the last one left to migrate
+            m_old_size = m_size;
+            if (m_migrated >= m_old_size)
+            {
+                release_old();
+            }
+        }
+    }
+
+    pointer allocate(size_type count)
+    {
+        return count == 0 ? nullptr : alloc_traits::allocate(m_alloc, count);
+    }
+
+    void deallocate(pointer data, size_type count) noexcept
+    {
+        if (data)
+        {
+            alloc_traits::deallocate(m_alloc, data, count);
+        }
+    }
+
+    void release_old() noexcept
+    {
+        deallocate(m_old, m_old_capacity);
+        m_old          = nullptr;
+        m_old_capacity = 0;
+        m_old_size     = 0;
+        m_migrated     = 0;
+    }
+
+    void grow();
+    void migrate(size_type count);
+    void reallocate(size_type new_capacity);
+
+    pointer                              m_data         = nullptr;
+    size_type                            m_capacity     = 0;
+    size_type                            m_size         = 0;
+    pointer                              m_old          = nullptr;
+    size_type                            m_old_capacity = 0;
+    size_type                            m_old_size     = 0;
+    size_type                            m_migrated     = 0;
+    size_type                            m_step         = MigrationStep;
+    [[no_unique_address]] allocator_type m_alloc;
+};
+
+/// ----------------------------------------------------------------------
+/// @class    Iterator
+/// @note Random-access iterator holding the container and a position, so
+/// it resolves the storage of each element as it is dereferenced.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t MigrationStep>
+template <bool Const>
+class IncrementalArrayList<T, GrowthPolicy, Allocator, MigrationStep>::Iterator {
+    using list_type = std::conditional_t<Const, const IncrementalArrayList, IncrementalArrayList>;
+
+public:
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef T                               value_type;
+    typedef std::ptrdiff_t                  difference_type;
+    typedef std::conditional_t<Const, const T*, T*> pointer;
+    typedef std::conditional_t<Const, const T&, T&> reference;
+
+    Iterator() noexcept = default;
+
+    Iterator(list_type* list, size_type index) noexcept
+        : m_list(list), m_index(static_cast<difference_type>(index)) {}
+
+    operator Iterator<true>() const noexcept requires (!Const)
+    {
+        return Iterator<true>(m_list, static_cast<size_type>(m_index));
+    }
+
+    reference operator*() const noexcept { return (*m_list)[static_cast<size_type>(m_index)]; }
+    pointer operator->() const noexcept { return std::addressof(**this); }
+    reference operator[](difference_type offset) const noexcept { return *(*this + offset); }
+
+    Iterator& operator++() noexcept { ++m_index; return *this; }
+    Iterator operator++(int) noexcept { Iterator old = *this; ++m_index; return old; }
+    Iterator& operator--() noexcept { --m_index; return *this; }
+    Iterator operator--(int) noexcept { Iterator old = *this; --m_index; return old; }
+
+    Iterator& operator+=(difference_type offset) noexcept { m_index += offset; return *this; }
+    Iterator& operator-=(difference_type offset) noexcept { m_index -= offset; return *this; }
+
+    friend Iterator operator+(Iterator it, difference_type offset) noexcept { return it += offset; }
+    friend Iterator operator+(difference_type offset, Iterator it) noexcept { return it += offset; }
+    friend Iterator operator-(Iterator it, difference_type offset) noexcept { return it -= offset; }
+
+    friend difference_type operator-(const Iterator& lhs, const Iterator& rhs) noexcept
+    {
+        return lhs.m_index - rhs.m_index;
+    }
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept { return lhs.m_index == rhs.m_index; }
+    friend auto operator<=>(const Iterator& lhs, const Iterator& rhs) noexcept { return lhs.m_index <=> rhs.m_index; }
+
+private:
+    list_type*      m_list  = nullptr;
+    difference_type m_index = 0;
+};
+
+//! ******************* D E F I N I T I O N S ************************ !//
+
+/// ----------------------------------------------------------------------
+/// @function IncrementalArrayList  </Copy Constructor/>
+/// @param    other    holds contents of source container
+/// @note The copy is contiguous, in storage of exactly its size.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t MigrationStep>
+IncrementalArrayList<T, GrowthPolicy, Allocator, MigrationStep>::IncrementalArrayList(const IncrementalArrayList& other)
+    : m_alloc(alloc_traits::select_on_container_copy_construction(other.m_alloc))
+{
+    m_data     = allocate(other.m_size);
+    m_capacity = other.m_size;
+
+    try
+    {
+        for (const auto& item : other)
+        {
+            alloc_traits::construct(m_alloc, std::to_address(m_data + m_size), item);
+            ++m_size;
+        }
+    }
+    catch (...)
+    {
+        clear();
+        deallocate(m_data, m_capacity);
+        throw;
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function emplace_back
+/// @param    args     holds the arguments to construct the element with
+/// @return   Returns a reference to the new back element.
+/// @note Appends, then migrates the next few elements. If moving one of
+/// those throws the new element stays appended and the exception
+/// propagates; the elements not moved stay in the old storage.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t MigrationStep>
+template <class... Args>
+typename IncrementalArrayList<T, GrowthPolicy, Allocator, MigrationStep>::reference
+IncrementalArrayList<T, GrowthPolicy, Allocator, MigrationStep>::emplace_back(Args&&... args)
+{
+    if (m_size == m_capacity)
+    {
+        if (migrating())
+        {
+            // only reachable after a migration step threw; finishing the
+            // migration destroys old elements args may name, so copy first
+            value_type value(std::forward<Args>(args)...);
+            finish_migration();
+            grow();
+            alloc_traits::construct(m_alloc, std::to_address(m_data + m_size), std::move(value));
+        }
+        else
+        {
+            // grow() keeps the old storage until the migration is done,
+            // so args pointing into it stay valid for the construct
+            grow();
+            alloc_traits::construct(m_alloc, std::to_address(m_data + m_size), std::forward<Args>(args)...);
+        }
+    }
+    else
+    {
+        alloc_traits::construct(m_alloc, std::to_address(m_data + m_size), std::forward<Args>(args)...);
+    }
+
+    ++m_size;
+    reference item = m_data[m_size - 1];
+    migrate(m_step);
+    return item;
+}
+
+/// ----------------------------------------------------------------------
+/// @function grow
+/// @note Switches to new storage from GrowthPolicy, leaving every element
+/// in the old one, and sizes the per-push step so the migration is done
+/// by the time the new storage is full.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t MigrationStep>
+void IncrementalArrayList<T, GrowthPolicy, Allocator, MigrationStep>::grow()
+{
+    const size_type new_capacity = GrowthPolicy::next_capacity(m_capacity, m_size + 1, sizeof(value_type));
+    pointer         temp         = allocate(new_capacity);
+
+    m_old          = std::exchange(m_data, temp);
+    m_old_capacity = std::exchange(m_capacity, new_capacity);
+    m_old_size     = m_size;
+    m_migrated     = 0;
+
+    if (m_old_size == 0)
+    {
+        release_old();
+        return;
+    }
+
+    const size_type room = new_capacity - m_size;
+    m_step = std::max(MigrationStep, (m_old_size + room - 1) / room);
+}
+
+/// ----------------------------------------------------------------------
+/// @function migrate
+/// @param    count    holds the most elements to move to the new storage
+/// @note Releases the old storage once it is empty. An element that
+/// throws while moving stays in the old storage.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t MigrationStep>
+void IncrementalArrayList<T, GrowthPolicy, Allocator, MigrationStep>::migrate(size_type count)
+{
+    if (!migrating())
+    {
+        return;
+    }
+
+    const size_type stop = m_migrated + std::min(count, m_old_size - m_migrated);
+
+    for (; m_migrated != stop; ++m_migrated)
+    {
+        alloc_traits::construct(m_alloc, std::to_address(m_data + m_migrated), std::move_if_noexcept(m_old[m_migrated]));
+        alloc_traits::destroy(m_alloc, std::to_address(m_old + m_migrated));
+    }
+
+    if (m_migrated == m_old_size)
+    {
+        release_old();
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function reallocate
+/// @param    new_capacity    holds the number of elements of the new storage
+/// @note Relocates every element at once, leaving the list unchanged if
+/// one throws. Expects no migration in progress.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t MigrationStep>
+void IncrementalArrayList<T, GrowthPolicy, Allocator, MigrationStep>::reallocate(size_type new_capacity)
+{
+    pointer   temp        = allocate(new_capacity);
+    size_type constructed = 0;
+
+    try
+    {
+        for (; constructed != m_size; ++constructed)
+        {
+            alloc_traits::construct(m_alloc, std::to_address(temp + constructed), std::move_if_noexcept(m_data[constructed]));
+        }
+    }
+    catch (...)
+    {
+        for (size_type index = 0; index != constructed; ++index)
+        {
+            alloc_traits::destroy(m_alloc, std::to_address(temp + index));
+        }
+        deallocate(temp, new_capacity);
+        throw;
+    }
+
+    const size_type count = m_size;
+    clear();
+    deallocate(m_data, m_capacity);
+
+    m_data     = temp;
+    m_capacity = new_capacity;
+    m_size     = count;
+}
+
+/// ----------------------------------------------------------------------
+/// @function operator==  </! Equality Operator !/>
+/// @param    lhs      holds the first container
+/// @param    rhs      holds the second container
+/// @return   Returns 'True' if both hold equal elements in the same order.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t MigrationStep>
+bool operator==(const IncrementalArrayList<T, GrowthPolicy, Allocator, MigrationStep>& lhs,
+                const IncrementalArrayList<T, GrowthPolicy, Allocator, MigrationStep>& rhs)
+{
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+/// ----------------------------------------------------------------------
+/// @function operator<<  </! Stream Insertion Operator !/>
+/// @param    output      Output stream where data is sent
+/// @param    list        Object of the class
+/// @return   Allows objects to be formatted and sent to output streams.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator, std::size_t MigrationStep>
+std::ostream& operator<<(std::ostream& output, const IncrementalArrayList<T, GrowthPolicy, Allocator, MigrationStep>& list)
+{
+    char separator[2]{};
+
+    output << '{';
+
+    for (const auto& item : list) {
+        output << separator << item;
+        *separator = ',';
+    }
+
+    return output << '}';
+}
+
+} // namespace AL
+
+#endif /* IncrementalArrayList_hpp */
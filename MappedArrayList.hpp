@@ -0,0 +1,776 @@
+/// @author - Brandon Wallace
+/// @file - MappedArrayList.hpp
+/// @brief - The MappedArrayList keeps its elements in a memory-mapped
+/// file, so a list of trivially copyable elements survives the process
+/// and reopens without being read or parsed. POSIX only.
+
+#ifndef MappedArrayList_hpp
+#define MappedArrayList_hpp
+
+/// C++ Standard Library Header Files
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+/// POSIX Header Files
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/// User Defined Header Files
+#include "ArrayList.hpp"
+
+namespace AL {
+
+/// ----------------------------------------------------------------------
+/// @enum     MapMode
+/// @note read_write opens the file, creating it when missing; the mapping
+/// is shared, so other processes see the writes. read_only maps the file
+/// without write access and makes every modifier throw, which lets any
+/// number of processes share one copy of the data.
+/// ----------------------------------------------------------------------
+
+enum class MapMode { read_write, read_only };
+
+/// ----------------------------------------------------------------------
+/// @enum     MapAdvice
+/// @note Access pattern hints passed on to madvise. hugepage asks for
+/// transparent huge pages and is ignored where they aren't supported.
+/// ----------------------------------------------------------------------
+
+enum class MapAdvice { normal, sequential, random, willneed, dontneed, hugepage };
+
+/// ----------------------------------------------------------------------
+/// @struct   MappedHeader
+/// @note First 64 bytes of the file. The elements start right after it, so
+/// they are aligned for any T with an alignment of up to 64.
+/// ----------------------------------------------------------------------
+
+struct alignas(64) MappedHeader {
+    static constexpr std::uint64_t magic_value   = 0x31504D4C41524101; // "\1ARALMP1"
+    static constexpr std::uint32_t current_version = 1;
+
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t element_size;
+    std::uint64_t size;
+    std::uint64_t capacity;
+};
+
+static_assert(sizeof(MappedHeader) == 64);
+
+/// ----------------------------------------------------------------------
+/// @class    MappedArrayList
+/// @note ArrayList whose storage is a shared mapping of a file laid out as
+/// a MappedHeader followed by capacity elements. The size lives in the
+/// header, so the file is always up to date in the page cache; flush()
+/// writes it to disk. Growth extends the file with ftruncate and the
+/// mapping with mremap, which may move it, so pointers and iterators are
+/// invalidated by growth just as with ArrayList.
+///
+/// The size is published with a release store and read with an acquire
+/// load. Another process's mapping only covers the file as it was when
+/// mapped, so size() never counts past it: a reader sees the elements
+/// of a file that a writer has grown only after refresh(). A writer's
+/// shrink_to_fit truncates the file under its readers, so it is only
+/// safe while no other process has the file mapped.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy = DoublingGrowth>
+class MappedArrayList {
+    static_assert(std::is_trivially_copyable_v<T>, "MappedArrayList elements must be trivially copyable");
+    static_assert(alignof(T) <= alignof(MappedHeader), "MappedArrayList elements must fit the header alignment");
+
+public:
+    typedef T                 value_type;
+    typedef std::size_t       size_type;
+    typedef std::ptrdiff_t    difference_type;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef pointer           iterator;
+    typedef const_pointer     const_iterator;
+
+    /// ----------------------------------------------------------------------
+    /// @function MappedArrayList
+    /// @param    path        holds the file to map
+    /// @param    mode        holds whether the mapping may be modified
+    /// @note A missing or empty file is initialised as an empty list in
+    /// read_write mode. Throws std::system_error when a system call fails and
+    /// std::runtime_error when the file wasn't written by a MappedArrayList
+    /// of the same element size.
+    /// ----------------------------------------------------------------------
+
+    explicit MappedArrayList(const std::string& path, MapMode mode = MapMode::read_write);
+
+    /// ----------------------------------------------------------------------
+    /// @function MappedArrayList  </Move Constructor/>
+    /// @param    other       holds contents of source container
+    /// @note Takes the mapping of other, which is left without one.
+    /// ----------------------------------------------------------------------
+
+    MappedArrayList(MappedArrayList&& other) noexcept;
+
+    MappedArrayList(const MappedArrayList&) = delete;
+    MappedArrayList& operator=(const MappedArrayList&) = delete;
+
+    /// ----------------------------------------------------------------------
+    /// @function ~MappedArrayList  </Destructor/>
+    /// @note Unmaps the file without flushing; the kernel writes the dirty
+    /// pages back in its own time.
+    /// ----------------------------------------------------------------------
+
+    ~MappedArrayList();
+
+    //! *** Element Access *** !//
+
+    /// ----------------------------------------------------------------------
+    /// @function at
+    /// @param    index    holds index to specified element
+    /// @return   Returns a reference to the element at the specified index.
+    /// ----------------------------------------------------------------------
+
+    reference       at(size_type index);
+    const_reference at(size_type index) const;
+
+    /// ----------------------------------------------------------------------
+    /// @function front / back
+    /// @return   Returns a reference to the first / last element.
+    /// ----------------------------------------------------------------------
+
+    reference       front()       { return at(0); }
+    const_reference front() const { return at(0); }
+    reference       back()        { return at(size() - 1); }
+    const_reference back() const  { return at(size() - 1); }
+
+    /// ----------------------------------------------------------------------
+    /// @function data
+    /// @return   Returns a pointer to the first element in the mapping.
+    /// ----------------------------------------------------------------------
+
+    pointer       data() noexcept       { return elements(); }
+    const_pointer data() const noexcept { return elements(); }
+
+    iterator       begin() noexcept       { return data(); }
+    const_iterator begin() const noexcept { return data(); }
+    iterator       end() noexcept         { return data() + size(); }
+    const_iterator end() const noexcept   { return data() + size(); }
+
+    //! *** Capacity *** !//
+
+    bool      empty() const noexcept    { return size() == 0; }
+
+    /// ----------------------------------------------------------------------
+    /// @function size / capacity
+    /// @return   Returns the values in the header, limited to the elements
+    ///           this object has mapped.
+    /// ----------------------------------------------------------------------
+
+    size_type size() const noexcept
+    {
+        return m_header ? std::min(load_header(m_header->size), mapped_capacity()) : 0;
+    }
+
+    size_type capacity() const noexcept
+    {
+        return m_header ? std::min(load_header(m_header->capacity), mapped_capacity()) : 0;
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @function read_only
+    /// @return   Returns 'True' if the file was mapped with MapMode::read_only.
+    /// ----------------------------------------------------------------------
+
+    bool read_only() const noexcept { return m_mode == MapMode::read_only; }
+
+    /// ----------------------------------------------------------------------
+    /// @function refresh
+    /// @note Maps the file again if another process has changed its length,
+    /// so the elements a writer appended past the old mapping are visible.
+    /// Invalidates pointers and iterators when the mapping changes.
+    /// ----------------------------------------------------------------------
+
+    void refresh();
+
+    /// ----------------------------------------------------------------------
+    /// @function reserve
+    /// @param    new_cap     holds the minimum capacity
+    /// @note Extends the file and the mapping when new_cap exceeds the
+    /// capacity.
+    /// ----------------------------------------------------------------------
+
+    void reserve(size_type new_cap);
+
+    /// ----------------------------------------------------------------------
+    /// @function shrink_to_fit
+    /// @note Truncates the file to the elements in use.
+    /// ----------------------------------------------------------------------
+
+    void shrink_to_fit();
+
+    //! *** Modifiers *** !//
+
+    void clear();
+    void push_back(const value_type& value);
+    void pop_back();
+
+    /// ----------------------------------------------------------------------
+    /// @function append
+    /// @param    values   holds the elements to append
+    /// @note Copies the elements with a single memcpy after at most one
+    /// growth step.
+    /// ----------------------------------------------------------------------
+
+    void append(std::span<const value_type> values);
+
+    /// ----------------------------------------------------------------------
+    /// @function resize
+    /// @param    count    holds the new size
+    /// @param    value    holds the value to copy into added elements
+    /// ----------------------------------------------------------------------
+
+    void resize(size_type count, const value_type& value = value_type());
+
+    /// ----------------------------------------------------------------------
+    /// @function flush
+    /// @param    async    holds whether to return before the write finishes
+    /// @note Writes the dirty pages of the header and the elements to disk
+    /// with msync.
+    /// ----------------------------------------------------------------------
+
+    void flush(bool async = false);
+
+    /// ----------------------------------------------------------------------
+    /// @function advise
+    /// @param    advice   holds the expected access pattern
+    /// @note Applies to the whole mapping. Growth creates a new mapping, so
+    /// advise again after the list has grown.
+    /// ----------------------------------------------------------------------
+
+    void advise(MapAdvice advice);
+
+    //! *** Operators *** !//
+
+    reference       operator[](size_type index) noexcept       { return elements()[index]; }
+    const_reference operator[](size_type index) const noexcept { return elements()[index]; }
+
+private:
+    static constexpr size_type max_capacity = (std::numeric_limits<std::size_t>::max() - sizeof(MappedHeader)) / sizeof(T);
+
+    static std::size_t mapping_bytes(size_type capacity) noexcept
+    {
+        return sizeof(MappedHeader) + capacity * sizeof(T);
+    }
+
+    /// Elements that fit in this object's own mapping.
+    size_type mapped_capacity() const noexcept
+    {
+        return (m_bytes - sizeof(MappedHeader)) / sizeof(T);
+    }
+
+    /// The header is shared with other processes, so its counts are
+    /// accessed atomically.
+    static size_type load_header(std::uint64_t& field) noexcept
+    {
+        return static_cast<size_type>(std::atomic_ref<std::uint64_t>(field).load(std::memory_order_acquire));
+    }
+
+    static void store_header(std::uint64_t& field, size_type value) noexcept
+    {
+        std::atomic_ref<std::uint64_t>(field).store(value, std::memory_order_release);
+    }
+
+    [[noreturn]] static void fail(const char* call)
+    {
+        throw std::system_error{ errno, std::generic_category(), call };
+    }
+
+    pointer elements() const noexcept
+    {
+        return m_header ? reinterpret_cast<pointer>(m_header + 1) : nullptr;
+    }
+
+    void check_writable() const;
+    void remap(size_type new_cap);
+    void unmap() noexcept;
+
+    int           m_fd     = -1;
+    MapMode       m_mode   = MapMode::read_write;
+    MappedHeader* m_header = nullptr;
+    std::size_t   m_bytes  = 0;
+};
+
+//! ******************* D E F I N I T I O N S ************************ !//
+
+/// ----------------------------------------------------------------------
+/// @function MappedArrayList
+/// @param    path        holds the file to map
+/// @param    mode        holds whether the mapping may be modified
+/// @note A missing or empty file is initialised as an empty list in
+/// read_write mode. Throws std::system_error when a system call fails and
+/// std::runtime_error when the file wasn't written by a MappedArrayList
+/// of the same element size.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+MappedArrayList<T, GrowthPolicy>::MappedArrayList(const std::string& path, MapMode mode)
+    : m_mode(mode)
+{
+    const bool writable = mode == MapMode::read_write;
+
+    m_fd = ::open(path.c_str(), writable ? O_RDWR | O_CREAT | O_CLOEXEC : O_RDONLY | O_CLOEXEC, 0644);
+    if (m_fd < 0)
+    {
+        fail("open");
+    }
+
+    try
+    {
+        struct stat info;
+        if (::fstat(m_fd, &info) != 0)
+        {
+            fail("fstat");
+        }
+
+        const auto file_bytes = static_cast<std::size_t>(info.st_size);
+        if (file_bytes == 0 && writable)
+        {
+            m_bytes = sizeof(MappedHeader);
+            if (::ftruncate(m_fd, static_cast<off_t>(m_bytes)) != 0)
+            {
+                fail("ftruncate");
+            }
+        }
+        else if (file_bytes < sizeof(MappedHeader))
+        {
+            throw std::runtime_error{ "File is too small to be a MappedArrayList!" };
+        }
+        else
+        {
+            m_bytes = file_bytes;
+        }
+
+        void* address = ::mmap(nullptr, m_bytes, writable ? PROT_READ | PROT_WRITE : PROT_READ,
+                               MAP_SHARED, m_fd, 0);
+        if (address == MAP_FAILED)
+        {
+            fail("mmap");
+        }
+        m_header = static_cast<MappedHeader*>(address);
+
+        if (file_bytes == 0)
+        {
+            *m_header = MappedHeader{ MappedHeader::magic_value, MappedHeader::current_version,
+                                      static_cast<std::uint32_t>(sizeof(T)), 0, 0 };
+        }
+        else if (m_header->magic != MappedHeader::magic_value ||
+                 m_header->version != MappedHeader::current_version)
+        {
+            throw std::runtime_error{ "File is not a MappedArrayList of a supported version!" };
+        }
+        else if (m_header->element_size != sizeof(T))
+        {
+            throw std::runtime_error{ "File holds elements of a different size!" };
+        }
+        else if (m_header->size > m_header->capacity || m_header->capacity > mapped_capacity())
+        {
+            // compared as counts, a corrupt capacity can't overflow a byte size
+            throw std::runtime_error{ "File is shorter than its header claims!" };
+        }
+    }
+    catch (...)
+    {
+        unmap();
+        throw;
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function MappedArrayList  </Move Constructor/>
+/// @param    other       holds contents of source container
+/// @note Takes the mapping of other, which is left without one.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+MappedArrayList<T, GrowthPolicy>::MappedArrayList(MappedArrayList&& other) noexcept
+    : m_fd(std::exchange(other.m_fd, -1)),
+      m_mode(other.m_mode),
+      m_header(std::exchange(other.m_header, nullptr)),
+      m_bytes(std::exchange(other.m_bytes, 0))
+{
+}
+
+/// ----------------------------------------------------------------------
+/// @function ~MappedArrayList  </Destructor/>
+/// @note Unmaps the file without flushing; the kernel writes the dirty
+/// pages back in its own time.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+MappedArrayList<T, GrowthPolicy>::~MappedArrayList()
+{
+    unmap();
+}
+
+/// ----------------------------------------------------------------------
+/// @function at
+/// @param    index    holds index to specified element
+/// @return   Returns a reference to the element at the specified index.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+typename MappedArrayList<T, GrowthPolicy>::reference
+MappedArrayList<T, GrowthPolicy>::at(size_type index)
+{
+    if (index >= size())
+    {
+        throw std::out_of_range{ "Accessed position is out of range!" };
+    }
+    return elements()[index];
+}
+
+template <class T, class GrowthPolicy>
+typename MappedArrayList<T, GrowthPolicy>::const_reference
+MappedArrayList<T, GrowthPolicy>::at(size_type index) const
+{
+    if (index >= size())
+    {
+        throw std::out_of_range{ "Accessed position is out of range!" };
+    }
+    return elements()[index];
+}
+
+/// ----------------------------------------------------------------------
+/// @function reserve
+/// @param    new_cap     holds the minimum capacity
+/// @note Extends the file and the mapping when new_cap exceeds the
+/// capacity.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+void MappedArrayList<T, GrowthPolicy>::reserve(size_type new_cap)
+{
+    check_writable();
+    if (new_cap > capacity())
+    {
+        remap(new_cap);
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function shrink_to_fit
+/// @note Truncates the file to the elements in use.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+void MappedArrayList<T, GrowthPolicy>::shrink_to_fit()
+{
+    check_writable();
+    if (size() < capacity())
+    {
+        remap(size());
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function clear
+/// @note Sets the size to zero and keeps the file length.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+void MappedArrayList<T, GrowthPolicy>::clear()
+{
+    check_writable();
+    store_header(m_header->size, 0);
+}
+
+/// ----------------------------------------------------------------------
+/// @function push_back
+/// @param    value    holds the value to append
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+void MappedArrayList<T, GrowthPolicy>::push_back(const value_type& value)
+{
+    append(std::span<const value_type>(&value, 1));
+}
+
+/// ----------------------------------------------------------------------
+/// @function pop_back
+/// @note Removes the last element.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+void MappedArrayList<T, GrowthPolicy>::pop_back()
+{
+    check_writable();
+    if (empty())
+    {
+        throw std::out_of_range{ "Accessed position is out of range!" };
+    }
+    store_header(m_header->size, size() - 1);
+}
+
+/// ----------------------------------------------------------------------
+/// @function append
+/// @param    values   holds the elements to append
+/// @note Copies the elements with a single memcpy after at most one
+/// growth step.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+void MappedArrayList<T, GrowthPolicy>::append(std::span<const value_type> values)
+{
+    check_writable();
+    if (values.empty())
+    {
+        return;
+    }
+
+    const size_type required = size() + values.size();
+    if (required > capacity())
+    {
+        // values may point into the mapping, which remap can move
+        const auto offset = values.data() - elements();
+        const bool inside = offset >= 0 && static_cast<size_type>(offset) < size();
+
+        remap(GrowthPolicy::next_capacity(capacity(), required, sizeof(T)));
+        if (inside)
+        {
+            values = std::span<const value_type>(elements() + offset, values.size());
+        }
+    }
+
+    std::memcpy(elements() + size(), values.data(), values.size() * sizeof(T));
+    store_header(m_header->size, required);
+}
+
+/// ----------------------------------------------------------------------
+/// @function resize
+/// @param    count    holds the new size
+/// @param    value    holds the value to copy into added elements
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+void MappedArrayList<T, GrowthPolicy>::resize(size_type count, const value_type& value)
+{
+    check_writable();
+    if (count > capacity())
+    {
+        remap(GrowthPolicy::next_capacity(capacity(), count, sizeof(T)));
+    }
+    if (count > size())
+    {
+        std::fill(elements() + size(), elements() + count, value);
+    }
+    store_header(m_header->size, count);
+}
+
+/// ----------------------------------------------------------------------
+/// @function flush
+/// @param    async    holds whether to return before the write finishes
+/// @note Writes the dirty pages of the header and the elements to disk
+/// with msync.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+void MappedArrayList<T, GrowthPolicy>::flush(bool async)
+{
+    if (::msync(m_header, mapping_bytes(size()), async ? MS_ASYNC : MS_SYNC) != 0)
+    {
+        fail("msync");
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function advise
+/// @param    advice   holds the expected access pattern
+/// @note Applies to the whole mapping. Growth creates a new mapping, so
+/// advise again after the list has grown.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+void MappedArrayList<T, GrowthPolicy>::advise(MapAdvice advice)
+{
+    int flag = MADV_NORMAL;
+    switch (advice)
+    {
+        case MapAdvice::normal:     flag = MADV_NORMAL;     break;
+        case MapAdvice::sequential: flag = MADV_SEQUENTIAL; break;
+        case MapAdvice::random:     flag = MADV_RANDOM;     break;
+        case MapAdvice::willneed:   flag = MADV_WILLNEED;   break;
+        case MapAdvice::dontneed:   flag = MADV_DONTNEED;   break;
+        case MapAdvice::hugepage:
+#if defined(MADV_HUGEPAGE)
+            flag = MADV_HUGEPAGE;
+            break;
+#else
+            return;
+#endif
+    }
+
+    if (::madvise(m_header, m_bytes, flag) != 0)
+    {
+        fail("madvise");
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function check_writable
+/// @note Throws std::logic_error for a read-only mapping.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+void MappedArrayList<T, GrowthPolicy>::check_writable() const
+{
+    if (read_only())
+    {
+        throw std::logic_error{ "MappedArrayList is mapped read-only!" };
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function remap
+/// @param    new_cap     holds the new capacity
+/// @note Resizes the file, then the mapping. mremap can move the mapping
+/// without copying any pages; elsewhere the file is mapped anew.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+void MappedArrayList<T, GrowthPolicy>::remap(size_type new_cap)
+{
+    if (new_cap > max_capacity)
+    {
+        throw std::length_error{ "MappedArrayList capacity is too large!" };
+    }
+
+    const std::size_t old_bytes = m_bytes;
+    const std::size_t new_bytes = mapping_bytes(new_cap);
+
+    // grow the file first so the mapping never extends past its end
+    if (new_bytes > old_bytes && ::ftruncate(m_fd, static_cast<off_t>(new_bytes)) != 0)
+    {
+        fail("ftruncate");
+    }
+
+#if defined(MREMAP_MAYMOVE)
+    void* address = ::mremap(m_header, old_bytes, new_bytes, MREMAP_MAYMOVE);
+    if (address == MAP_FAILED)
+    {
+        fail("mremap");
+    }
+#else
+    void* address = ::mmap(nullptr, new_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (address == MAP_FAILED)
+    {
+        fail("mmap");
+    }
+    ::munmap(m_header, old_bytes);
+#endif
+
+    m_header = static_cast<MappedHeader*>(address);
+    m_bytes  = new_bytes;
+    store_header(m_header->capacity, new_cap);
+
+    if (new_bytes < old_bytes && ::ftruncate(m_fd, static_cast<off_t>(new_bytes)) != 0)
+    {
+        fail("ftruncate");
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function refresh
+/// @note Maps the file again if another process has changed its length,
+/// so the elements a writer appended past the old mapping are visible.
+/// Invalidates pointers and iterators when the mapping changes.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+void MappedArrayList<T, GrowthPolicy>::refresh()
+{
+    struct stat info;
+    if (::fstat(m_fd, &info) != 0)
+    {
+        fail("fstat");
+    }
+
+    const auto new_bytes = static_cast<std::size_t>(info.st_size);
+    if (new_bytes == m_bytes)
+    {
+        return;
+    }
+    if (new_bytes < sizeof(MappedHeader))
+    {
+        throw std::runtime_error{ "File is too small to be a MappedArrayList!" };
+    }
+
+    void* address = ::mmap(nullptr, new_bytes, read_only() ? PROT_READ : PROT_READ | PROT_WRITE,
+                           MAP_SHARED, m_fd, 0);
+    if (address == MAP_FAILED)
+    {
+        fail("mmap");
+    }
+
+    ::munmap(m_header, m_bytes);
+    m_header = static_cast<MappedHeader*>(address);
+    m_bytes  = new_bytes;
+}
+
+/// ----------------------------------------------------------------------
+/// @function unmap
+/// @note Releases the mapping and the file descriptor.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+void MappedArrayList<T, GrowthPolicy>::unmap() noexcept
+{
+    if (m_header)
+    {
+        ::munmap(m_header, m_bytes);
+        m_header = nullptr;
+    }
+    if (m_fd >= 0)
+    {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function operator<<  </! Stream Insertion Operator !/>
+/// @param    output      Output stream where data is sent
+/// @param    list        Object of the class
+/// @return   Allows objects to be formatted and sent to output streams.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+std::ostream& operator<<(std::ostream& output, const MappedArrayList<T, GrowthPolicy>& list)
+{
+    char separator[2]{};
+
+    output << '{';
+
+    for (const T& item : list) {
+        output << separator << item;
+        *separator = ',';
+    }
+
+    return output << '}';
+}
+
+} // namespace AL
+
+#endif /* MappedArrayList_hpp */
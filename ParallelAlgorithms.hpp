@@ -0,0 +1,729 @@
+/// @author - Brandon Wallace
+/// @file - ParallelAlgorithms.hpp
+/// @brief - A work-stealing thread pool and parallel for_each, transform,
+/// reduce, sort and stable_sort over contiguous containers such as the
+/// ArrayList.
+
+#ifndef ParallelAlgorithms_hpp
+#define ParallelAlgorithms_hpp
+
+/// C++ Standard Library Header Files
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/// User Defined Header Files
+#include "ArrayList.hpp"
+
+namespace AL {
+
+//! ************************** Thread Pool *************************** !//
+
+/// ----------------------------------------------------------------------
+/// @class    thread_pool
+/// @note Fixed set of worker threads, each with its own task queue. A
+/// worker pops the newest task from its own queue and, once that is empty,
+/// steals the oldest task from another queue, so chunks that turn out to be
+/// expensive are spread over the threads that are free. A thread waiting
+/// in parallel_for runs queued tasks instead of blocking, which also makes
+/// nested calls safe.
+/// ----------------------------------------------------------------------
+
+class thread_pool {
+public:
+    /// ----------------------------------------------------------------------
+    /// @function thread_pool  </Constructor/>
+    /// @param    threads     holds the number of worker threads
+    /// @note The thread calling parallel_for works as well, so a pool of
+    /// N - 1 workers keeps N cores busy. With no workers everything runs
+    /// on the calling thread.
+    /// ----------------------------------------------------------------------
+
+    explicit thread_pool(std::size_t threads = default_concurrency());
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    /// ----------------------------------------------------------------------
+    /// @function ~thread_pool  </Destructor/>
+    /// @note Finishes the queued tasks and joins the workers.
+    /// ----------------------------------------------------------------------
+
+    ~thread_pool();
+
+    /// ----------------------------------------------------------------------
+    /// @function size
+    /// @return   Returns the number of worker threads.
+    /// ----------------------------------------------------------------------
+
+    std::size_t size() const noexcept { return m_threads.size(); }
+
+    /// ----------------------------------------------------------------------
+    /// @function parallel_for
+    /// @param    count       holds the number of indices to cover
+    /// @param    chunk       holds the number of indices per task
+    /// @param    body        holds the callable invoked as body(first, last)
+    /// @note Splits [0, count) into tasks of chunk indices and returns once
+    /// every task has run. The first exception thrown by body is rethrown
+    /// here; the tasks that haven't started by then are skipped.
+    /// ----------------------------------------------------------------------
+
+    template <class Function>
+    void parallel_for(std::size_t count, std::size_t chunk, Function&& body);
+
+    /// ----------------------------------------------------------------------
+    /// @function default_concurrency
+    /// @return   Returns the number of workers that, together with the
+    ///           calling thread, occupies every hardware thread.
+    /// ----------------------------------------------------------------------
+
+    static std::size_t default_concurrency() noexcept
+    {
+        const std::size_t hardware = std::thread::hardware_concurrency();
+        return hardware > 1 ? hardware - 1 : 0;
+    }
+
+private:
+    using Task = std::function<void()>;
+
+    // one queue per worker and a shared one for outside threads, each on
+    // its own cache line so the owners don't contend for it
+    struct alignas(64) Queue {
+        std::mutex       mutex;
+        std::deque<Task> tasks;
+    };
+
+    void push(std::size_t queue, Task task);
+    bool run_one(std::size_t home);
+    void worker_loop(std::size_t index);
+    std::size_t home_queue() const noexcept;
+
+    static const thread_pool*& current_pool() noexcept;
+    static std::size_t&        current_index() noexcept;
+
+    std::vector<std::unique_ptr<Queue>> m_queues;
+    std::vector<std::thread>            m_threads;
+    std::atomic<std::size_t>            m_pending{ 0 };
+    std::mutex                          m_sleep_mutex;
+    std::condition_variable             m_wake;
+    bool                                m_stop = false;
+};
+
+/// ----------------------------------------------------------------------
+/// @function default_thread_pool
+/// @return   Returns the pool used by the algorithms called without one.
+///           It is created on first use with default_concurrency() workers.
+/// ----------------------------------------------------------------------
+
+inline thread_pool& default_thread_pool()
+{
+    static thread_pool pool;
+    return pool;
+}
+
+//! ******************* D E F I N I T I O N S ************************ !//
+
+/// ----------------------------------------------------------------------
+/// @function thread_pool  </Constructor/>
+/// @param    threads     holds the number of worker threads
+/// @note The thread calling parallel_for works as well, so a pool of
+/// N - 1 workers keeps N cores busy. With no workers everything runs
+/// on the calling thread.
+/// ----------------------------------------------------------------------
+
+inline thread_pool::thread_pool(std::size_t threads)
+{
+    m_queues.reserve(threads + 1);
+    for (std::size_t index = 0; index <= threads; ++index)
+    {
+        m_queues.push_back(std::make_unique<Queue>());
+    }
+
+    m_threads.reserve(threads);
+    try
+    {
+        for (std::size_t index = 0; index < threads; ++index)
+        {
+            m_threads.emplace_back([this, index] { worker_loop(index); });
+        }
+    }
+    catch (...)
+    {
+        // the destructor won't run, so stop the workers already started
+        {
+            std::lock_guard<std::mutex> lock(m_sleep_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        for (std::thread& thread : m_threads)
+        {
+            thread.join();
+        }
+        throw;
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function ~thread_pool  </Destructor/>
+/// @note Finishes the queued tasks and joins the workers.
+/// ----------------------------------------------------------------------
+
+inline thread_pool::~thread_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_sleep_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+
+    for (std::thread& thread : m_threads)
+    {
+        thread.join();
+    }
+    m_threads.clear();
+}
+
+/// ----------------------------------------------------------------------
+/// @function parallel_for
+/// @param    count       holds the number of indices to cover
+/// @param    chunk       holds the number of indices per task
+/// @param    body        holds the callable invoked as body(first, last)
+/// @note Splits [0, count) into tasks of chunk indices and returns once
+/// every task has run. The first exception thrown by body, or by queueing
+/// a task, is rethrown here once no queued task refers to this call any
+/// more; the tasks that haven't started by then are skipped.
+/// ----------------------------------------------------------------------
+
+template <class Function>
+void thread_pool::parallel_for(std::size_t count, std::size_t chunk, Function&& body)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    if (chunk == 0)
+    {
+        chunk = 1;
+    }
+
+    const std::size_t tasks = (count - 1) / chunk + 1;
+    if (tasks == 1 || m_threads.empty())
+    {
+        body(std::size_t(0), count);
+        return;
+    }
+
+    struct Job {
+        explicit Job(std::size_t tasks) : remaining(tasks) {}
+
+        std::atomic<std::size_t> remaining;
+        std::atomic<bool>        failed{ false };
+        std::exception_ptr       error;
+        std::mutex               error_mutex;
+    } job(tasks);
+
+    // give each queue a contiguous run of chunks so neighbouring memory
+    // stays on one core until someone has to steal
+    const std::size_t queues = m_queues.size();
+    const std::size_t home   = home_queue();
+    std::size_t       task   = 0;
+    try
+    {
+        for (; task < tasks; ++task)
+        {
+            const std::size_t first = task * chunk;
+            const std::size_t last  = std::min(count, first + chunk);
+
+            push((home + task * queues / tasks) % queues, [&job, &body, first, last] {
+                if (!job.failed.load(std::memory_order_relaxed))
+                {
+                    try
+                    {
+                        body(first, last);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard<std::mutex> lock(job.error_mutex);
+                        if (!job.error)
+                        {
+                            job.error = std::current_exception();
+                        }
+                        job.failed.store(true, std::memory_order_relaxed);
+                    }
+                }
+                job.remaining.fetch_sub(1, std::memory_order_acq_rel);
+            });
+        }
+    }
+    catch (...)
+    {
+        // the tasks already queued refer to job, so they are drained below
+        // as usual and the ones never queued are no longer waited for
+        {
+            std::lock_guard<std::mutex> lock(job.error_mutex);
+            if (!job.error)
+            {
+                job.error = std::current_exception();
+            }
+        }
+        job.failed.store(true, std::memory_order_relaxed);
+        job.remaining.fetch_sub(tasks - task, std::memory_order_acq_rel);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_sleep_mutex);
+    }
+    m_wake.notify_all();
+
+    while (job.remaining.load(std::memory_order_acquire) != 0)
+    {
+        if (!run_one(home))
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    if (job.error)
+    {
+        std::rethrow_exception(job.error);
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function push
+/// @param    queue       holds the index of the queue to add to
+/// @param    task        holds the task to add
+/// ----------------------------------------------------------------------
+
+inline void thread_pool::push(std::size_t queue, Task task)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_queues[queue]->mutex);
+        m_queues[queue]->tasks.push_back(std::move(task));
+    }
+    m_pending.fetch_add(1, std::memory_order_release);
+}
+
+/// ----------------------------------------------------------------------
+/// @function run_one
+/// @param    home        holds the index of the calling thread's queue
+/// @return   Returns 'True' if a task was found and run.
+/// @note Takes the newest task from home, otherwise the oldest task of the
+/// first other queue that has one.
+/// ----------------------------------------------------------------------
+
+inline bool thread_pool::run_one(std::size_t home)
+{
+    Task task;
+    const std::size_t queues = m_queues.size();
+
+    for (std::size_t offset = 0; offset < queues && !task; ++offset)
+    {
+        Queue& queue = *m_queues[(home + offset) % queues];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+
+        if (queue.tasks.empty())
+        {
+            continue;
+        }
+        if (offset == 0)
+        {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        }
+        else
+        {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+    }
+
+    if (!task)
+    {
+        return false;
+    }
+
+    m_pending.fetch_sub(1, std::memory_order_relaxed);
+    task();
+    return true;
+}
+
+/// ----------------------------------------------------------------------
+/// @function worker_loop
+/// @param    index       holds the index of the worker's queue
+/// ----------------------------------------------------------------------
+
+inline void thread_pool::worker_loop(std::size_t index)
+{
+    current_pool()  = this;
+    current_index() = index;
+
+    while (true)
+    {
+        if (run_one(index))
+        {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_sleep_mutex);
+        m_wake.wait(lock, [this] {
+            return m_stop || m_pending.load(std::memory_order_acquire) != 0;
+        });
+        if (m_stop && m_pending.load(std::memory_order_acquire) == 0)
+        {
+            return;
+        }
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function home_queue
+/// @return   Returns the queue of the calling worker, or the shared queue
+///           if the caller doesn't belong to this pool.
+/// ----------------------------------------------------------------------
+
+inline std::size_t thread_pool::home_queue() const noexcept
+{
+    return current_pool() == this ? current_index() : m_threads.size();
+}
+
+inline const thread_pool*& thread_pool::current_pool() noexcept
+{
+    thread_local const thread_pool* pool = nullptr;
+    return pool;
+}
+
+inline std::size_t& thread_pool::current_index() noexcept
+{
+    thread_local std::size_t index = 0;
+    return index;
+}
+
+namespace detail {
+
+/// ----------------------------------------------------------------------
+/// @struct   ParallelRange
+/// @note Bounds of a contiguous range and the chunking used to split it.
+/// Chunk boundaries after the first fall on 64-byte lines, so no two
+/// tasks write to the same cache line.
+/// ----------------------------------------------------------------------
+
+template <class T>
+struct ParallelRange {
+    static constexpr std::size_t cache_line = 64;
+
+    ParallelRange(T* data, std::size_t size, const thread_pool& pool, std::size_t chunk)
+        : m_data(data), m_size(size)
+    {
+        if (chunk == 0)
+        {
+            // a few chunks per thread leave room for stealing
+            chunk = std::max<std::size_t>(size / ((pool.size() + 1) * 8), 1);
+            chunk = std::max<std::size_t>(chunk, 4096 / sizeof(T) + 1);
+        }
+
+        if constexpr (cache_line % sizeof(T) == 0)
+        {
+            constexpr std::size_t per_line = cache_line / sizeof(T);
+
+            chunk = (chunk + per_line - 1) / per_line * per_line;
+
+            const auto address = reinterpret_cast<std::uintptr_t>(data);
+            if (address % sizeof(T) == 0)
+            {
+                m_head = (cache_line - address % cache_line) % cache_line / sizeof(T);
+                m_head = std::min(m_head, size);
+            }
+        }
+        m_chunk = chunk;
+    }
+
+    // number of tasks, index 0 being the unaligned head when there is one
+    std::size_t tasks() const noexcept
+    {
+        const std::size_t rest = m_size - m_head;
+        return (m_head != 0) + (rest == 0 ? 0 : (rest - 1) / m_chunk + 1);
+    }
+
+    // element bounds of the tasks [first, last)
+    std::pair<std::size_t, std::size_t> bounds(std::size_t first, std::size_t last) const noexcept
+    {
+        if (m_head != 0)
+        {
+            const std::size_t begin = first == 0 ? 0 : m_head + (first - 1) * m_chunk;
+            const std::size_t end   = last == 0 ? 0 : m_head + (last - 1) * m_chunk;
+            return { begin, std::min(end, m_size) };
+        }
+        return { first * m_chunk, std::min(last * m_chunk, m_size) };
+    }
+
+    T*          m_data;
+    std::size_t m_size;
+    std::size_t m_chunk = 1;
+    std::size_t m_head  = 0;
+};
+
+/// ----------------------------------------------------------------------
+/// @function parallel_chunks
+/// @param    pool        holds the pool to run on
+/// @param    data        holds the first element of the range
+/// @param    size        holds the number of elements
+/// @param    chunk       holds the elements per task, 0 to choose
+/// @param    body        holds the callable invoked as body(first, last)
+///                       with element indices
+/// ----------------------------------------------------------------------
+
+template <class T, class Function>
+void parallel_chunks(thread_pool& pool, T* data, std::size_t size,
+                     std::size_t chunk, Function&& body)
+{
+    const ParallelRange<T> range(data, size, pool, chunk);
+
+    pool.parallel_for(range.tasks(), 1, [&](std::size_t first, std::size_t last) {
+        const auto [begin, end] = range.bounds(first, last);
+        body(begin, end);
+    });
+}
+
+/// ----------------------------------------------------------------------
+/// @function parallel_merge_sort
+/// @param    pool        holds the pool to run on
+/// @param    data        holds the first element of the range
+/// @param    size        holds the number of elements
+/// @param    sort        holds the callable sorting one block
+/// @param    comp        holds the comparison
+/// @note Sorts one block per thread, then merges neighbouring blocks in
+/// rounds; std::inplace_merge is stable, so a stable block sort gives a
+/// stable result.
+/// ----------------------------------------------------------------------
+
+template <class T, class Sort, class Compare>
+void parallel_merge_sort(thread_pool& pool, T* data, std::size_t size,
+                         Sort&& sort, Compare& comp)
+{
+    constexpr std::size_t min_block = 2048;
+
+    const std::size_t blocks = std::min(pool.size() + 1, size / min_block);
+    if (blocks <= 1)
+    {
+        sort(data, data + size);
+        return;
+    }
+
+    std::vector<std::size_t> bounds(blocks + 1);
+    for (std::size_t block = 0; block <= blocks; ++block)
+    {
+        bounds[block] = size / blocks * block + std::min(block, size % blocks);
+    }
+
+    pool.parallel_for(blocks, 1, [&](std::size_t first, std::size_t last) {
+        for (std::size_t block = first; block < last; ++block)
+        {
+            sort(data + bounds[block], data + bounds[block + 1]);
+        }
+    });
+
+    for (std::size_t width = 1; width < blocks; width *= 2)
+    {
+        const std::size_t merges = (blocks - 1) / (2 * width) + 1;
+
+        pool.parallel_for(merges, 1, [&](std::size_t first, std::size_t last) {
+            for (std::size_t merge = first; merge < last; ++merge)
+            {
+                const std::size_t left = merge * 2 * width;
+                if (left + width < blocks)
+                {
+                    std::inplace_merge(data + bounds[left],
+                                       data + bounds[left + width],
+                                       data + bounds[std::min(left + 2 * width, blocks)],
+                                       comp);
+                }
+            }
+        });
+    }
+}
+
+} // namespace detail
+
+//! ********************** Parallel Algorithms *********************** !//
+
+/// ----------------------------------------------------------------------
+/// @function parallel_for_each
+/// @param    pool        holds the pool to run on
+/// @param    range       holds the contiguous container to visit
+/// @param    func        holds the callable invoked with each element
+/// @param    chunk       holds the elements per task, 0 to choose
+/// @note func runs concurrently on different elements.
+/// ----------------------------------------------------------------------
+
+template <std::ranges::contiguous_range R, class Function>
+void parallel_for_each(thread_pool& pool, R&& range, Function func, std::size_t chunk = 0)
+{
+    auto* data = std::ranges::data(range);
+
+    detail::parallel_chunks(pool, data, std::ranges::size(range), chunk,
+                            [&](std::size_t first, std::size_t last) {
+        std::for_each(data + first, data + last, std::ref(func));
+    });
+}
+
+template <std::ranges::contiguous_range R, class Function>
+void parallel_for_each(R&& range, Function func)
+{
+    parallel_for_each(default_thread_pool(), std::forward<R>(range), std::move(func));
+}
+
+/// ----------------------------------------------------------------------
+/// @function parallel_transform
+/// @param    pool        holds the pool to run on
+/// @param    input       holds the contiguous container to read
+/// @param    output      holds the contiguous container to write, which
+///                       must have at least as many elements as input
+/// @param    op          holds the callable applied to each element
+/// @param    chunk       holds the elements per task, 0 to choose
+/// @note The chunks follow the output, so each task owns whole cache
+/// lines of it. input and output may be the same container.
+/// ----------------------------------------------------------------------
+
+template <std::ranges::contiguous_range In, std::ranges::contiguous_range Out, class UnaryOp>
+void parallel_transform(thread_pool& pool, const In& input, Out&& output,
+                        UnaryOp op, std::size_t chunk = 0)
+{
+    const auto  size = std::ranges::size(input);
+    const auto* src  = std::ranges::data(input);
+    auto*       dst  = std::ranges::data(output);
+
+    if (std::ranges::size(output) < size)
+    {
+        throw std::out_of_range{ "Output range is smaller than the input range!" };
+    }
+
+    detail::parallel_chunks(pool, dst, size, chunk,
+                            [&](std::size_t first, std::size_t last) {
+        std::transform(src + first, src + last, dst + first, std::ref(op));
+    });
+}
+
+template <std::ranges::contiguous_range In, std::ranges::contiguous_range Out, class UnaryOp>
+void parallel_transform(const In& input, Out&& output, UnaryOp op)
+{
+    parallel_transform(default_thread_pool(), input, std::forward<Out>(output), std::move(op));
+}
+
+/// ----------------------------------------------------------------------
+/// @function parallel_reduce
+/// @param    pool        holds the pool to run on
+/// @param    range       holds the contiguous container to reduce
+/// @param    init        holds the initial value
+/// @param    op          holds the binary operation, which must be
+///                       associative
+/// @param    chunk       holds the elements per task, 0 to choose
+/// @return   Returns init combined with every element. Each chunk is
+///           reduced in order and the partial results are combined left
+///           to right, so op doesn't have to be commutative.
+/// ----------------------------------------------------------------------
+
+template <std::ranges::contiguous_range R, class T, class BinaryOp = std::plus<>>
+T parallel_reduce(thread_pool& pool, const R& range, T init, BinaryOp op = {}, std::size_t chunk = 0)
+{
+    const auto* data = std::ranges::data(range);
+    const detail::ParallelRange<const std::remove_pointer_t<decltype(data)>>
+        split(data, std::ranges::size(range), pool, chunk);
+
+    // partial results get a cache line each to avoid false sharing
+    struct alignas(64) Partial {
+        std::optional<T> value;
+    };
+    std::vector<Partial> partials(split.tasks());
+
+    pool.parallel_for(partials.size(), 1, [&](std::size_t first, std::size_t last) {
+        for (std::size_t task = first; task < last; ++task)
+        {
+            const auto [begin, end] = split.bounds(task, task + 1);
+
+            T value = data[begin];
+            for (std::size_t index = begin + 1; index < end; ++index)
+            {
+                value = op(std::move(value), data[index]);
+            }
+            partials[task].value.emplace(std::move(value));
+        }
+    });
+
+    for (Partial& partial : partials)
+    {
+        init = op(std::move(init), std::move(*partial.value));
+    }
+    return init;
+}
+
+template <std::ranges::contiguous_range R, class T, class BinaryOp = std::plus<>>
+T parallel_reduce(const R& range, T init, BinaryOp op = {})
+{
+    return parallel_reduce(default_thread_pool(), range, std::move(init), std::move(op));
+}
+
+/// ----------------------------------------------------------------------
+/// @function parallel_sort
+/// @param    pool        holds the pool to run on
+/// @param    range       holds the contiguous container to sort
+/// @param    comp        holds the comparison
+/// ----------------------------------------------------------------------
+
+template <std::ranges::contiguous_range R, class Compare = std::less<>>
+void parallel_sort(thread_pool& pool, R&& range, Compare comp = {})
+{
+    auto* data = std::ranges::data(range);
+
+    detail::parallel_merge_sort(pool, data, std::ranges::size(range),
+                                [&](auto first, auto last) { std::sort(first, last, comp); },
+                                comp);
+}
+
+template <std::ranges::contiguous_range R, class Compare = std::less<>>
+void parallel_sort(R&& range, Compare comp = {})
+{
+    parallel_sort(default_thread_pool(), std::forward<R>(range), std::move(comp));
+}
+
+/// ----------------------------------------------------------------------
+/// @function parallel_stable_sort
+/// @param    pool        holds the pool to run on
+/// @param    range       holds the contiguous container to sort
+/// @param    comp        holds the comparison
+/// @note Equal elements keep their relative order.
+/// ----------------------------------------------------------------------
+
+template <std::ranges::contiguous_range R, class Compare = std::less<>>
+void parallel_stable_sort(thread_pool& pool, R&& range, Compare comp = {})
+{
+    auto* data = std::ranges::data(range);
+
+    detail::parallel_merge_sort(pool, data, std::ranges::size(range),
+                                [&](auto first, auto last) { std::stable_sort(first, last, comp); },
+                                comp);
+}
+
+template <std::ranges::contiguous_range R, class Compare = std::less<>>
+void parallel_stable_sort(R&& range, Compare comp = {})
+{
+    parallel_stable_sort(default_thread_pool(), std::forward<R>(range), std::move(comp));
+}
+
+} // namespace AL
+
+#endif /* ParallelAlgorithms_hpp */
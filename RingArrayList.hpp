@@ -0,0 +1,711 @@
+/// @author - Brandon Wallace
+/// @file - RingArrayList.hpp
+/// @brief - The RingArrayList is a double-ended queue kept in one
+/// circular buffer: pushing and popping at either end are amortized O(1),
+/// and a bounded ring overwrites its oldest element once full.
+
+#ifndef RingArrayList_hpp
+#define RingArrayList_hpp
+
+/// C++ Standard Library Header Files
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/// User Defined Header Files
+#include "ArrayList.hpp"
+
+namespace AL {
+
+/// ----------------------------------------------------------------------
+/// @enum     RingMode
+/// @note What a full RingArrayList does on push: grow its storage through
+/// the GrowthPolicy, or overwrite the element at the opposite end, i.e.
+/// the oldest one for push_back.
+/// ----------------------------------------------------------------------
+
+enum class RingMode { grow, overwrite };
+
+/// ----------------------------------------------------------------------
+/// @class    RingArrayList
+/// @note The elements occupy size() consecutive slots of the storage,
+/// starting at the head and wrapping from the last slot to the first, so
+/// both ends move without shifting anything. Growth goes through
+/// GrowthPolicy and Allocator like ArrayList, relocating the elements in
+/// order to the start of the new storage.
+///
+/// In RingMode::overwrite the capacity given at construction is the
+/// bound: pushing onto a full ring replaces the element at the other end.
+/// Iterators are random-access and handle the wraparound; linearize()
+/// makes the elements contiguous when a span is needed.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy = DoublingGrowth, class Allocator = std::allocator<T>>
+class RingArrayList {
+    template <bool Const>
+    class Iterator;
+
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+public:
+    typedef T                                      value_type;
+    typedef Allocator                              allocator_type;
+    typedef std::size_t                            size_type;
+    typedef std::ptrdiff_t                         difference_type;
+    typedef value_type&                            reference;
+    typedef const value_type&                      const_reference;
+    typedef typename alloc_traits::pointer         pointer;
+    typedef typename alloc_traits::const_pointer   const_pointer;
+    typedef Iterator<false>                        iterator;
+    typedef Iterator<true>                         const_iterator;
+
+    /// ----------------------------------------------------------------------
+    /// @function RingArrayList  </Default Constructor/>
+    /// @param    alloc    holds the allocator used for all the storage
+    /// ----------------------------------------------------------------------
+
+    RingArrayList() noexcept(noexcept(Allocator())) = default;
+    explicit RingArrayList(const allocator_type& alloc) noexcept : m_alloc(alloc) {}
+
+    /// ----------------------------------------------------------------------
+    /// @function RingArrayList
+    /// @param    capacity holds the number of slots to allocate
+    /// @param    mode     holds what a push onto a full ring does
+    /// @param    alloc    holds the allocator used for all the storage
+    /// @note RingMode::overwrite needs a capacity of at least 1.
+    /// ----------------------------------------------------------------------
+
+    RingArrayList(size_type capacity, RingMode mode, const allocator_type& alloc = allocator_type());
+
+    /// ----------------------------------------------------------------------
+    /// @function RingArrayList
+    /// @param    init_list   holds the elements to copy, front to back
+    /// ----------------------------------------------------------------------
+
+    RingArrayList(std::initializer_list<value_type> init_list, const allocator_type& alloc = allocator_type())
+        : RingArrayList(alloc)
+    {
+        reserve(init_list.size());
+        for (const auto& item : init_list)
+        {
+            push_back(item);
+        }
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @function RingArrayList  </Copy Constructor/>
+    /// @param    other    holds contents of source container
+    /// @note A bounded ring keeps its bound; a growing ring is copied into
+    /// storage of exactly its size.
+    /// ----------------------------------------------------------------------
+
+    RingArrayList(const RingArrayList& other);
+
+    /// ----------------------------------------------------------------------
+    /// @function RingArrayList  </Move Constructor/>
+    /// @param    other    holds contents of source container
+    /// ----------------------------------------------------------------------
+
+    RingArrayList(RingArrayList&& other) noexcept
+        : m_data(std::exchange(other.m_data, nullptr)),
+          m_capacity(std::exchange(other.m_capacity, 0)),
+          m_head(std::exchange(other.m_head, 0)),
+          m_size(std::exchange(other.m_size, 0)),
+          m_mode(other.m_mode),
+          m_alloc(std::move(other.m_alloc)) {}
+
+    /// ----------------------------------------------------------------------
+    /// @function ~RingArrayList  </Destructor/>
+    /// ----------------------------------------------------------------------
+
+    ~RingArrayList()
+    {
+        clear();
+        deallocate(m_data, m_capacity);
+    }
+
+    //! *** Element Access *** !//
+
+    /// ----------------------------------------------------------------------
+    /// @function at
+    /// @param    index    holds the position counted from the front
+    /// @return   Returns a reference to the element at the position.
+    /// @note Throws std::out_of_range for an index past size().
+    /// ----------------------------------------------------------------------
+
+    reference at(size_type index)
+    {
+        check_index(index);
+        return m_data[physical(index)];
+    }
+
+    const_reference at(size_type index) const
+    {
+        check_index(index);
+        return m_data[physical(index)];
+    }
+
+    reference       front()       { return at(0); }
+    const_reference front() const { return at(0); }
+    reference       back()        { return at(m_size - 1); }
+    const_reference back() const  { return at(m_size - 1); }
+
+    iterator       begin() noexcept        { return iterator(this, 0); }
+    const_iterator begin() const noexcept  { return const_iterator(this, 0); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    iterator       end() noexcept          { return iterator(this, m_size); }
+    const_iterator end() const noexcept    { return const_iterator(this, m_size); }
+    const_iterator cend() const noexcept   { return end(); }
+
+    /// ----------------------------------------------------------------------
+    /// @function linearize
+    /// @return   Returns the elements, front to back, as one contiguous span.
+    /// @note O(1) unless the elements wrap around the end of the storage,
+    /// in which case they are rotated to its start in place, without
+    /// allocating. Only a T whose move constructor may throw is relocated
+    /// through new storage instead. Invalidates pointers to the elements
+    /// but not iterators, which hold positions.
+    /// ----------------------------------------------------------------------
+
+    std::span<value_type> linearize()
+        noexcept(is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>)
+    {
+        if (m_head + m_size > m_capacity)
+        {
+            if constexpr (is_trivially_relocatable_v<T>)
+            {
+                // the free slots are rotated along as raw bytes
+                auto* bytes = reinterpret_cast<std::byte*>(std::to_address(m_data));
+                std::rotate(bytes, bytes + m_head * sizeof(T), bytes + m_capacity * sizeof(T));
+                m_head = 0;
+            }
+            else if constexpr (std::is_nothrow_move_constructible_v<T>)
+            {
+                rotate_to_start();
+            }
+            else
+            {
+                reallocate(m_capacity);
+            }
+        }
+        return { std::to_address(m_data) + m_head, m_size };
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @function spans
+    /// @return   Returns the elements as the two contiguous runs they occupy,
+    ///           front to the end of the storage, then its start to back.
+    ///           The second run is empty unless the elements wrap.
+    /// ----------------------------------------------------------------------
+
+    std::pair<std::span<const value_type>, std::span<const value_type>> spans() const noexcept
+    {
+        const value_type* data  = std::to_address(m_data);
+        const size_type   first = std::min(m_size, m_capacity - m_head);
+        return { { data + m_head, first }, { data, m_size - first } };
+    }
+
+    //! *** Capacity *** !//
+
+    bool      empty() const noexcept    { return m_size == 0; }
+    size_type size() const noexcept     { return m_size; }
+    size_type capacity() const noexcept { return m_capacity; }
+    RingMode  mode() const noexcept     { return m_mode; }
+
+    allocator_type get_allocator() const noexcept { return m_alloc; }
+
+    /// ----------------------------------------------------------------------
+    /// @function reserve
+    /// @param    new_capacity    holds the minimum number of slots
+    /// @note Raises the bound of a RingMode::overwrite ring.
+    /// ----------------------------------------------------------------------
+
+    void reserve(size_type new_capacity)
+    {
+        if (new_capacity > m_capacity)
+        {
+            reallocate(new_capacity);
+        }
+    }
+
+    //! *** Modifiers *** !//
+
+    void clear() noexcept
+    {
+        while (m_size != 0)
+        {
+            pop_back_unchecked();
+        }
+        m_head = 0;
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @function push_back
+    /// @param    value    holds the value to append
+    /// ----------------------------------------------------------------------
+
+    void push_back(const value_type& value) { emplace_back(value); }
+    void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+    /// ----------------------------------------------------------------------
+    /// @function push_front
+    /// @param    value    holds the value to prepend
+    /// ----------------------------------------------------------------------
+
+    void push_front(const value_type& value) { emplace_front(value); }
+    void push_front(value_type&& value) { emplace_front(std::move(value)); }
+
+    /// ----------------------------------------------------------------------
+    /// @function emplace_back
+    /// @param    args     holds the arguments to construct the element with
+    /// @return   Returns a reference to the new back element.
+    /// @note A full ring grows, or in RingMode::overwrite replaces the front.
+    /// ----------------------------------------------------------------------
+
+    template <class... Args>
+    reference emplace_back(Args&&... args);
+
+    /// ----------------------------------------------------------------------
+    /// @function emplace_front
+    /// @param    args     holds the arguments to construct the element with
+    /// @return   Returns a reference to the new front element.
+    /// @note A full ring grows, or in RingMode::overwrite replaces the back.
+    /// ----------------------------------------------------------------------
+
+    template <class... Args>
+    reference emplace_front(Args&&... args);
+
+    /// ----------------------------------------------------------------------
+    /// @function pop_front, pop_back
+    /// @note Throw std::out_of_range when the container is empty.
+    /// ----------------------------------------------------------------------
+
+    void pop_front()
+    {
+        check_index(0);
+        alloc_traits::destroy(m_alloc, std::to_address(m_data + m_head));
+        m_head = advance(m_head);
+        --m_size;
+    }
+
+    void pop_back()
+    {
+        check_index(0);
+        pop_back_unchecked();
+    }
+
+    void swap(RingArrayList& other) noexcept
+    {
+        using std::swap;
+        swap(m_data, other.m_data);
+        swap(m_capacity, other.m_capacity);
+        swap(m_head, other.m_head);
+        swap(m_size, other.m_size);
+        swap(m_mode, other.m_mode);
+        swap(m_alloc, other.m_alloc);
+    }
+
+    //! *** Operators *** !//
+
+    /// ----------------------------------------------------------------------
+    /// @function operator=  </Copy and Move Assignment Operator/>
+    /// @param    other      holds contents of source container
+    /// @return   Returns a reference to this container.
+    /// ----------------------------------------------------------------------
+
+    RingArrayList& operator=(RingArrayList other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    reference       operator[](size_type index) noexcept       { return m_data[physical(index)]; }
+    const_reference operator[](size_type index) const noexcept { return m_data[physical(index)]; }
+
+private:
+    /// Storage slot of the element 'index' positions from the front.
+    size_type physical(size_type index) const noexcept
+    {
+        const size_type slot = m_head + index;
+        return slot >= m_capacity ? slot - m_capacity : slot;
+    }
+
+    size_type advance(size_type slot) const noexcept { return slot + 1 == m_capacity ? 0 : slot + 1; }
+
+    /// Slot m_head places after slot, used by rotate_to_start().
+    size_type advance_by(size_type slot) const noexcept
+    {
+        return slot >= m_capacity - m_head ? slot + m_head - m_capacity : slot + m_head;
+    }
+    size_type retreat(size_type slot) const noexcept { return slot == 0 ? m_capacity - 1 : slot - 1; }
+
+    void check_index(size_type index) const
+    {
+        if (index >= m_size)
+        {
+            throw std::out_of_range{ "Accessed position is out of range!" };
+        }
+    }
+
+    void pop_back_unchecked() noexcept
+    {
+        alloc_traits::destroy(m_alloc, std::to_address(m_data + physical(m_size - 1)));
+        --m_size;
+    }
+
+    size_type next_capacity() const
+    {
+        return GrowthPolicy::next_capacity(m_capacity, m_size + 1, sizeof(value_type));
+    }
+
+    pointer allocate(size_type count)
+    {
+        return count == 0 ? nullptr : alloc_traits::allocate(m_alloc, count);
+    }
+
+    void deallocate(pointer data, size_type count) noexcept
+    {
+        if (data)
+        {
+            alloc_traits::deallocate(m_alloc, data, count);
+        }
+    }
+
+    void reallocate(size_type new_capacity);
+    void rotate_to_start() noexcept;
+
+    pointer                              m_data     = nullptr;
+    size_type                            m_capacity = 0;
+    size_type                            m_head     = 0;
+    size_type                            m_size     = 0;
+    RingMode                             m_mode     = RingMode::grow;
+    [[no_unique_address]] allocator_type m_alloc;
+};
+
+/// ----------------------------------------------------------------------
+/// @class    Iterator
+/// @note Random-access iterator holding the container and a position
+/// counted from the front, so it steps across the wraparound and stays
+/// valid when linearize() moves the elements.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator>
+template <bool Const>
+class RingArrayList<T, GrowthPolicy, Allocator>::Iterator {
+    using ring_type = std::conditional_t<Const, const RingArrayList, RingArrayList>;
+
+public:
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef T                               value_type;
+    typedef std::ptrdiff_t                  difference_type;
+    typedef std::conditional_t<Const, const T*, T*> pointer;
+    typedef std::conditional_t<Const, const T&, T&> reference;
+
+    Iterator() noexcept = default;
+
+    Iterator(ring_type* ring, size_type index) noexcept
+        : m_ring(ring), m_index(static_cast<difference_type>(index)) {}
+
+    operator Iterator<true>() const noexcept requires (!Const)
+    {
+        return Iterator<true>(m_ring, static_cast<size_type>(m_index));
+    }
+
+    reference operator*() const noexcept { return (*m_ring)[static_cast<size_type>(m_index)]; }
+    pointer operator->() const noexcept { return std::addressof(**this); }
+    reference operator[](difference_type offset) const noexcept { return *(*this + offset); }
+
+    Iterator& operator++() noexcept { ++m_index; return *this; }
+    Iterator operator++(int) noexcept { Iterator old = *this; ++m_index; return old; }
+    Iterator& operator--() noexcept { --m_index; return *this; }
+    Iterator operator--(int) noexcept { Iterator old = *this; --m_index; return old; }
+
+    Iterator& operator+=(difference_type offset) noexcept { m_index += offset; return *this; }
+    Iterator& operator-=(difference_type offset) noexcept { m_index -= offset; return *this; }
+
+    friend Iterator operator+(Iterator it, difference_type offset) noexcept { return it += offset; }
+    friend Iterator operator+(difference_type offset, Iterator it) noexcept { return it += offset; }
+    friend Iterator operator-(Iterator it, difference_type offset) noexcept { return it -= offset; }
+
+    friend difference_type operator-(const Iterator& lhs, const Iterator& rhs) noexcept
+    {
+        return lhs.m_index - rhs.m_index;
+    }
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept { return lhs.m_index == rhs.m_index; }
+    friend auto operator<=>(const Iterator& lhs, const Iterator& rhs) noexcept { return lhs.m_index <=> rhs.m_index; }
+
+private:
+    ring_type*      m_ring  = nullptr;
+    difference_type m_index = 0;
+};
+
+//! ******************* D E F I N I T I O N S ************************ !//
+
+/// ----------------------------------------------------------------------
+/// @function RingArrayList
+/// @param    capacity holds the number of slots to allocate
+/// @param    mode     holds what a push onto a full ring does
+/// @param    alloc    holds the allocator used for all the storage
+/// @note RingMode::overwrite needs a capacity of at least 1.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator>
+RingArrayList<T, GrowthPolicy, Allocator>::RingArrayList(size_type capacity, RingMode mode, const allocator_type& alloc)
+    : m_mode(mode), m_alloc(alloc)
+{
+    if (mode == RingMode::overwrite && capacity == 0)
+    {
+        throw std::invalid_argument{ "A bounded RingArrayList needs a capacity!" };
+    }
+    m_data     = allocate(capacity);
+    m_capacity = capacity;
+}
+
+/// ----------------------------------------------------------------------
+/// @function RingArrayList  </Copy Constructor/>
+/// @param    other    holds contents of source container
+/// @note A bounded ring keeps its bound; a growing ring is copied into
+/// storage of exactly its size.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator>
+RingArrayList<T, GrowthPolicy, Allocator>::RingArrayList(const RingArrayList& other)
+    : m_mode(other.m_mode),
+      m_alloc(alloc_traits::select_on_container_copy_construction(other.m_alloc))
+{
+    const size_type capacity = m_mode == RingMode::overwrite ? other.m_capacity : other.m_size;
+
+    m_data     = allocate(capacity);
+    m_capacity = capacity;
+
+    try
+    {
+        for (const auto& item : other)
+        {
+            alloc_traits::construct(m_alloc, std::to_address(m_data + m_size), item);
+            ++m_size;
+        }
+    }
+    catch (...)
+    {
+        clear();
+        deallocate(m_data, m_capacity);
+        throw;
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function emplace_back
+/// @param    args     holds the arguments to construct the element with
+/// @return   Returns a reference to the new back element.
+/// @note A full ring grows, or in RingMode::overwrite replaces the front.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator>
+template <class... Args>
+typename RingArrayList<T, GrowthPolicy, Allocator>::reference
+RingArrayList<T, GrowthPolicy, Allocator>::emplace_back(Args&&... args)
+{
+    if (m_size == m_capacity)
+    {
+        // overwriting the front or reallocating can pull an element out
+        // from under args, e.g. push_back(front()), so build it up front
+        value_type value(std::forward<Args>(args)...);
+
+        if (m_mode == RingMode::overwrite)
+        {
+            // the front slot becomes the back one
+            reference slot = m_data[m_head];
+            slot   = std::move(value);
+            m_head = advance(m_head);
+            return slot;
+        }
+
+        reallocate(next_capacity());
+        alloc_traits::construct(m_alloc, std::to_address(m_data + physical(m_size)), std::move(value));
+    }
+    else
+    {
+        alloc_traits::construct(m_alloc, std::to_address(m_data + physical(m_size)), std::forward<Args>(args)...);
+    }
+
+    ++m_size;
+    return back();
+}
+
+/// ----------------------------------------------------------------------
+/// @function emplace_front
+/// @param    args     holds the arguments to construct the element with
+/// @return   Returns a reference to the new front element.
+/// @note A full ring grows, or in RingMode::overwrite replaces the back.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator>
+template <class... Args>
+typename RingArrayList<T, GrowthPolicy, Allocator>::reference
+RingArrayList<T, GrowthPolicy, Allocator>::emplace_front(Args&&... args)
+{
+    if (m_size == m_capacity)
+    {
+        // the same holds for the back slot, e.g. push_front(back())
+        value_type value(std::forward<Args>(args)...);
+
+        if (m_mode == RingMode::overwrite)
+        {
+            // the back slot becomes the front one
+            m_head = retreat(m_head);
+            reference slot = m_data[m_head];
+            slot = std::move(value);
+            return slot;
+        }
+
+        reallocate(next_capacity());
+        alloc_traits::construct(m_alloc, std::to_address(m_data + retreat(m_head)), std::move(value));
+    }
+    else
+    {
+        alloc_traits::construct(m_alloc, std::to_address(m_data + retreat(m_head)), std::forward<Args>(args)...);
+    }
+
+    m_head = retreat(m_head);
+    ++m_size;
+    return m_data[m_head];
+}
+
+/// ----------------------------------------------------------------------
+/// @function reallocate
+/// @param    new_capacity    holds the number of slots of the new storage
+/// @note Relocates the elements in order to the start of new storage,
+/// leaving the ring unchanged if an element throws.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator>
+void RingArrayList<T, GrowthPolicy, Allocator>::reallocate(size_type new_capacity)
+{
+    pointer   temp        = allocate(new_capacity);
+    size_type constructed = 0;
+
+    try
+    {
+        for (; constructed != m_size; ++constructed)
+        {
+            alloc_traits::construct(m_alloc, std::to_address(temp + constructed),
+                                    std::move_if_noexcept(m_data[physical(constructed)]));
+        }
+    }
+    catch (...)
+    {
+        for (size_type index = 0; index != constructed; ++index)
+        {
+            alloc_traits::destroy(m_alloc, std::to_address(temp + index));
+        }
+        deallocate(temp, new_capacity);
+        throw;
+    }
+
+    const size_type count = m_size;
+    clear();
+    deallocate(m_data, m_capacity);
+
+    m_data     = temp;
+    m_capacity = new_capacity;
+    m_head     = 0;
+    m_size     = count;
+}
+
+/// ----------------------------------------------------------------------
+/// @function rotate_to_start
+/// @note Moves the element in each slot to the slot 'm_head' places
+/// before it, following the gcd(capacity, head) cycles of the rotation
+/// with one element held aside per cycle. Free slots travel along
+/// without being constructed, so the storage needs no spare room.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator>
+void RingArrayList<T, GrowthPolicy, Allocator>::rotate_to_start() noexcept
+{
+    // whether a slot held an element before the rotation started; every
+    // slot is read once, so its original state is the one that matters
+    const auto occupied = [this](size_type slot) {
+        return (slot >= m_head ? slot - m_head : slot + m_capacity - m_head) < m_size;
+    };
+    const auto relocate = [this](size_type to, value_type& from) {
+        alloc_traits::construct(m_alloc, std::to_address(m_data + to), std::move(from));
+        alloc_traits::destroy(m_alloc, std::addressof(from));
+    };
+
+    const size_type cycles = std::gcd(m_capacity, m_head);
+    for (size_type start = 0; start != cycles; ++start)
+    {
+        std::optional<value_type> held;
+        if (occupied(start))
+        {
+            held.emplace(std::move(m_data[start]));
+            alloc_traits::destroy(m_alloc, std::to_address(m_data + start));
+        }
+
+        size_type slot = start;
+        for (size_type from = advance_by(start); from != start; slot = from, from = advance_by(from))
+        {
+            if (occupied(from))
+            {
+                relocate(slot, m_data[from]);
+            }
+        }
+        if (held)
+        {
+            alloc_traits::construct(m_alloc, std::to_address(m_data + slot), std::move(*held));
+        }
+    }
+    m_head = 0;
+}
+
+/// ----------------------------------------------------------------------
+/// @function operator==  </! Equality Operator !/>
+/// @param    lhs      holds the first container
+/// @param    rhs      holds the second container
+/// @return   Returns 'True' if both hold equal elements in the same order.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator>
+bool operator==(const RingArrayList<T, GrowthPolicy, Allocator>& lhs, const RingArrayList<T, GrowthPolicy, Allocator>& rhs)
+{
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+/// ----------------------------------------------------------------------
+/// @function operator<<  </! Stream Insertion Operator !/>
+/// @param    output      Output stream where data is sent
+/// @param    list        Object of the class
+/// @return   Allows objects to be formatted and sent to output streams.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy, class Allocator>
+std::ostream& operator<<(std::ostream& output, const RingArrayList<T, GrowthPolicy, Allocator>& list)
+{
+    char separator[2]{};
+
+    output << '{';
+
+    for (const auto& item : list) {
+        output << separator << item;
+        *separator = ',';
+    }
+
+    return output << '}';
+}
+
+} // namespace AL
+
+#endif /* RingArrayList_hpp */
@@ -0,0 +1,755 @@
+/// @author - Brandon Wallace
+/// @file - SegmentedArrayList.hpp
+/// @brief - The SegmentedArrayList stores its elements in fixed-size
+/// chunks reached through a directory. Growing adds a chunk instead of
+/// copying the whole array, and elements never move.
+
+#ifndef SegmentedArrayList_hpp
+#define SegmentedArrayList_hpp
+
+/// C++ Standard Library Header Files
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/// User Defined Header Files
+#include "ArrayList.hpp"
+
+namespace AL {
+
+/// ----------------------------------------------------------------------
+/// @function default_chunk_size
+/// @return   Returns the number of elements that fill about 64 KiB,
+///           rounded down to a power of two.
+/// ----------------------------------------------------------------------
+
+template <class T>
+constexpr std::size_t default_chunk_size() noexcept
+{
+    return std::bit_floor(std::max<std::size_t>(65536 / sizeof(T), 1));
+}
+
+/// ----------------------------------------------------------------------
+/// @class    SegmentedArrayList
+/// @note Elements live in chunks of ChunkSize, a power of two, so element
+/// i is directory[i / ChunkSize][i % ChunkSize]. Growth allocates one more
+/// chunk and at most reallocates the directory of chunk pointers, so there
+/// is no copy of the elements and peak memory stays one chunk above the
+/// live size. References and pointers stay valid until their element is
+/// erased.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t ChunkSize = default_chunk_size<T>(), class Allocator = std::allocator<T>>
+class SegmentedArrayList {
+    static_assert(std::has_single_bit(ChunkSize), "ChunkSize must be a power of two");
+
+public:
+    typedef T                 value_type;
+    typedef Allocator         allocator_type;
+    typedef std::size_t       size_type;
+    typedef std::ptrdiff_t    difference_type;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+
+    template <bool IsConst>
+    class Iterator;
+
+    using iterator               = Iterator<false>;
+    using const_iterator         = Iterator<true>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr size_type chunk_size = ChunkSize;
+
+    /// ----------------------------------------------------------------------
+    /// @function SegmentedArrayList  </Default Constructor/>
+    /// @param    alloc       holds the allocator for the chunks
+    /// ----------------------------------------------------------------------
+
+    SegmentedArrayList() noexcept(noexcept(Allocator())) : SegmentedArrayList(Allocator()) {}
+    explicit SegmentedArrayList(const Allocator& alloc) noexcept
+        : m_chunks(directory_allocator(alloc)), m_alloc(alloc) {}
+
+    /// ----------------------------------------------------------------------
+    /// @function SegmentedArrayList
+    /// @param    count       holds the number of elements
+    /// @param    value       holds the value to copy into each element
+    /// @param    alloc       holds the allocator for the chunks
+    /// ----------------------------------------------------------------------
+
+    explicit SegmentedArrayList(size_type count, const Allocator& alloc = Allocator());
+    SegmentedArrayList(size_type count, const value_type& value, const Allocator& alloc = Allocator());
+
+    /// ----------------------------------------------------------------------
+    /// @function SegmentedArrayList
+    /// @param    init_list   holds the elements to copy
+    /// @param    alloc       holds the allocator for the chunks
+    /// ----------------------------------------------------------------------
+
+    SegmentedArrayList(std::initializer_list<value_type> init_list, const Allocator& alloc = Allocator());
+
+    /// ----------------------------------------------------------------------
+    /// @function SegmentedArrayList  </Copy Constructor/>
+    /// @param    other       holds contents of source container
+    /// ----------------------------------------------------------------------
+
+    SegmentedArrayList(const SegmentedArrayList& other);
+
+    /// ----------------------------------------------------------------------
+    /// @function SegmentedArrayList  </Move Constructor/>
+    /// @param    other       holds contents of source container
+    /// @note Takes the chunks of other, which is left empty.
+    /// ----------------------------------------------------------------------
+
+    SegmentedArrayList(SegmentedArrayList&& other) noexcept;
+
+    /// ----------------------------------------------------------------------
+    /// @function ~SegmentedArrayList  </Destructor/>
+    /// ----------------------------------------------------------------------
+
+    ~SegmentedArrayList();
+
+    //! *** Element Access *** !//
+
+    /// ----------------------------------------------------------------------
+    /// @function at
+    /// @param    index    holds index to specified element
+    /// @return   Returns a reference to the element at the specified index.
+    /// @note Throws std::out_of_range for an index past size().
+    /// ----------------------------------------------------------------------
+
+    reference       at(size_type index);
+    const_reference at(size_type index) const;
+
+    /// ----------------------------------------------------------------------
+    /// @function front
+    /// @return   Returns a reference to the first element.
+    /// ----------------------------------------------------------------------
+
+    reference       front()       { return at(0); }
+    const_reference front() const { return at(0); }
+
+    /// ----------------------------------------------------------------------
+    /// @function back
+    /// @return   Returns a reference to the last element.
+    /// ----------------------------------------------------------------------
+
+    reference       back()       { return at(size() - 1); }
+    const_reference back() const { return at(size() - 1); }
+
+    /// ----------------------------------------------------------------------
+    /// @function chunk
+    /// @param    index    holds index of the chunk
+    /// @return   Returns the elements of the chunk as a contiguous span.
+    ///           Every chunk but the last is full.
+    /// @note Loops over chunk(0) ... chunk(chunk_count() - 1) see plain
+    /// arrays, which the compiler can vectorise.
+    /// ----------------------------------------------------------------------
+
+    std::span<value_type>       chunk(size_type index) noexcept;
+    std::span<const value_type> chunk(size_type index) const noexcept;
+
+    /// ----------------------------------------------------------------------
+    /// @function chunk_count
+    /// @return   Returns the number of chunks holding elements.
+    /// ----------------------------------------------------------------------
+
+    size_type chunk_count() const noexcept { return (m_size + ChunkSize - 1) / ChunkSize; }
+
+    /// ----------------------------------------------------------------------
+    /// @function begin
+    /// @return   Returns an iterator to the first element.
+    /// ----------------------------------------------------------------------
+
+    iterator       begin() noexcept        { return iterator(m_chunks.data(), 0); }
+    const_iterator begin() const noexcept  { return const_iterator(m_chunks.data(), 0); }
+    const_iterator cbegin() const noexcept { return begin(); }
+
+    /// ----------------------------------------------------------------------
+    /// @function end
+    /// @return   Returns an iterator past the last element.
+    /// ----------------------------------------------------------------------
+
+    iterator       end() noexcept        { return iterator(m_chunks.data(), m_size); }
+    const_iterator end() const noexcept  { return const_iterator(m_chunks.data(), m_size); }
+    const_iterator cend() const noexcept { return end(); }
+
+    /// ----------------------------------------------------------------------
+    /// @function rbegin / rend
+    /// @return   Returns reverse iterators over the elements.
+    /// ----------------------------------------------------------------------
+
+    reverse_iterator       rbegin() noexcept       { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    reverse_iterator       rend() noexcept         { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept   { return const_reverse_iterator(begin()); }
+
+    //! *** Capacity *** !//
+
+    /// ----------------------------------------------------------------------
+    /// @function empty
+    /// @return   Returns 'True' if the container is empty.
+    /// ----------------------------------------------------------------------
+
+    bool empty() const noexcept { return m_size == 0; }
+
+    /// ----------------------------------------------------------------------
+    /// @function size
+    /// @return   Returns the number of elements.
+    /// ----------------------------------------------------------------------
+
+    size_type size() const noexcept { return m_size; }
+
+    /// ----------------------------------------------------------------------
+    /// @function capacity
+    /// @return   Returns the number of elements the allocated chunks hold.
+    /// ----------------------------------------------------------------------
+
+    size_type capacity() const noexcept { return m_chunks.size() * ChunkSize; }
+
+    /// ----------------------------------------------------------------------
+    /// @function reserve
+    /// @param    new_cap     holds the minimum capacity
+    /// @note Allocates chunks until new_cap elements fit.
+    /// ----------------------------------------------------------------------
+
+    void reserve(size_type new_cap);
+
+    /// ----------------------------------------------------------------------
+    /// @function shrink_to_fit
+    /// @note Frees the chunks past the last element.
+    /// ----------------------------------------------------------------------
+
+    void shrink_to_fit() noexcept;
+
+    //! *** Modifiers *** !//
+
+    /// ----------------------------------------------------------------------
+    /// @function clear
+    /// @note Destroys the elements and keeps the chunks.
+    /// ----------------------------------------------------------------------
+
+    void clear() noexcept;
+
+    /// ----------------------------------------------------------------------
+    /// @function push_back
+    /// @param    value    holds the value to append
+    /// ----------------------------------------------------------------------
+
+    void push_back(const value_type& value) { emplace_back(value); }
+    void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+    /// ----------------------------------------------------------------------
+    /// @function emplace_back
+    /// @param    args     holds the arguments to construct the element with
+    /// @return   Returns a reference to the new element.
+    /// ----------------------------------------------------------------------
+
+    template <class... Args>
+    reference emplace_back(Args&&... args);
+
+    /// ----------------------------------------------------------------------
+    /// @function pop_back
+    /// @note Destroys the last element; the chunk is kept for reuse.
+    /// ----------------------------------------------------------------------
+
+    void pop_back();
+
+    /// ----------------------------------------------------------------------
+    /// @function resize
+    /// @param    count    holds the new size
+    /// @param    value    holds the value to copy into added elements
+    /// ----------------------------------------------------------------------
+
+    void resize(size_type count);
+    void resize(size_type count, const value_type& value);
+
+    /// ----------------------------------------------------------------------
+    /// @function swap
+    /// @param    other    holds the container to exchange contents with
+    /// ----------------------------------------------------------------------
+
+    void swap(SegmentedArrayList& other) noexcept;
+
+    //! *** Operators *** !//
+
+    /// ----------------------------------------------------------------------
+    /// @function operator=  </Copy and Move Assignment Operator/>
+    /// @param    other      holds contents of source container
+    /// @return   Returns a reference to this container.
+    /// ----------------------------------------------------------------------
+
+    SegmentedArrayList& operator=(SegmentedArrayList other) noexcept;
+
+    /// ----------------------------------------------------------------------
+    /// @function operator[]
+    /// @param    index    holds index to specified element
+    /// @return   Returns a reference to the element at the specified index.
+    /// ----------------------------------------------------------------------
+
+    reference operator[](size_type index) noexcept
+    {
+        return m_chunks[index / ChunkSize][index % ChunkSize];
+    }
+
+    const_reference operator[](size_type index) const noexcept
+    {
+        return m_chunks[index / ChunkSize][index % ChunkSize];
+    }
+
+private:
+    using alloc_traits = std::allocator_traits<Allocator>;
+    using directory_allocator = typename alloc_traits::template rebind_alloc<pointer>;
+
+    template <class Construct>
+    void grow_to(size_type count, Construct&& construct);
+
+    void add_chunk();
+
+    BasicArrayList<pointer, DoublingGrowth, directory_allocator> m_chunks;
+    size_type m_size = 0;
+    [[no_unique_address]] Allocator m_alloc;
+};
+
+/// ----------------------------------------------------------------------
+/// @class    Iterator
+/// @note Random-access iterator that goes through the chunk directory.
+/// It stays valid while the directory isn't reallocated, i.e. until a
+/// new chunk is added.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t ChunkSize, class Allocator>
+template <bool IsConst>
+class SegmentedArrayList<T, ChunkSize, Allocator>::Iterator {
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = T;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = std::conditional_t<IsConst, const T*, T*>;
+    using reference         = std::conditional_t<IsConst, const T&, T&>;
+
+    Iterator() noexcept = default;
+    Iterator(T* const* chunks, size_type index) noexcept : m_chunks(chunks), m_index(index) {}
+
+    operator Iterator<true>() const noexcept requires (!IsConst)
+    {
+        return Iterator<true>(m_chunks, m_index);
+    }
+
+    reference operator*() const noexcept  { return m_chunks[m_index / ChunkSize][m_index % ChunkSize]; }
+    pointer   operator->() const noexcept { return &**this; }
+    reference operator[](difference_type offset) const noexcept { return *(*this + offset); }
+
+    Iterator& operator++() noexcept    { ++m_index; return *this; }
+    Iterator  operator++(int) noexcept { Iterator temp = *this; ++m_index; return temp; }
+    Iterator& operator--() noexcept    { --m_index; return *this; }
+    Iterator  operator--(int) noexcept { Iterator temp = *this; --m_index; return temp; }
+
+    Iterator& operator+=(difference_type offset) noexcept { m_index += offset; return *this; }
+    Iterator& operator-=(difference_type offset) noexcept { m_index -= offset; return *this; }
+
+    friend Iterator operator+(Iterator it, difference_type offset) noexcept { return it += offset; }
+    friend Iterator operator+(difference_type offset, Iterator it) noexcept { return it += offset; }
+    friend Iterator operator-(Iterator it, difference_type offset) noexcept { return it -= offset; }
+
+    friend difference_type operator-(const Iterator& lhs, const Iterator& rhs) noexcept
+    {
+        return static_cast<difference_type>(lhs.m_index) - static_cast<difference_type>(rhs.m_index);
+    }
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept
+    {
+        return lhs.m_index == rhs.m_index;
+    }
+
+    friend auto operator<=>(const Iterator& lhs, const Iterator& rhs) noexcept
+    {
+        return lhs.m_index <=> rhs.m_index;
+    }
+
+private:
+    T* const* m_chunks = nullptr;
+    size_type m_index  = 0;
+};
+
+//! ******************* D E F I N I T I O N S ************************ !//
+
+/// ----------------------------------------------------------------------
+/// @function SegmentedArrayList
+/// @param    count       holds the number of elements
+/// @param    value       holds the value to copy into each element
+/// @param    alloc       holds the allocator for the chunks
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t ChunkSize, class Allocator>
+SegmentedArrayList<T, ChunkSize, Allocator>::SegmentedArrayList(size_type count, const Allocator& alloc)
+    : m_chunks(directory_allocator(alloc)), m_alloc(alloc)
+{
+    resize(count);
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+SegmentedArrayList<T, ChunkSize, Allocator>::SegmentedArrayList(size_type count, const value_type& value,
+                                                                const Allocator& alloc)
+    : m_chunks(directory_allocator(alloc)), m_alloc(alloc)
+{
+    resize(count, value);
+}
+
+/// ----------------------------------------------------------------------
+/// @function SegmentedArrayList
+/// @param    init_list   holds the elements to copy
+/// @param    alloc       holds the allocator for the chunks
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t ChunkSize, class Allocator>
+SegmentedArrayList<T, ChunkSize, Allocator>::SegmentedArrayList(std::initializer_list<value_type> init_list,
+                                                                const Allocator& alloc)
+    : m_chunks(directory_allocator(alloc)), m_alloc(alloc)
+{
+    reserve(init_list.size());
+    for (const value_type& item : init_list)
+    {
+        emplace_back(item);
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function SegmentedArrayList  </Copy Constructor/>
+/// @param    other       holds contents of source container
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t ChunkSize, class Allocator>
+SegmentedArrayList<T, ChunkSize, Allocator>::SegmentedArrayList(const SegmentedArrayList& other)
+    : m_chunks(directory_allocator(alloc_traits::select_on_container_copy_construction(other.m_alloc))),
+      m_alloc(alloc_traits::select_on_container_copy_construction(other.m_alloc))
+{
+    reserve(other.size());
+    for (size_type index = 0; index < other.chunk_count(); ++index)
+    {
+        for (const value_type& item : other.chunk(index))
+        {
+            emplace_back(item);
+        }
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function SegmentedArrayList  </Move Constructor/>
+/// @param    other       holds contents of source container
+/// @note Takes the chunks of other, which is left empty.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t ChunkSize, class Allocator>
+SegmentedArrayList<T, ChunkSize, Allocator>::SegmentedArrayList(SegmentedArrayList&& other) noexcept
+    : m_chunks(std::move(other.m_chunks)), m_size(std::exchange(other.m_size, 0)), m_alloc(other.m_alloc)
+{
+}
+
+/// ----------------------------------------------------------------------
+/// @function ~SegmentedArrayList  </Destructor/>
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t ChunkSize, class Allocator>
+SegmentedArrayList<T, ChunkSize, Allocator>::~SegmentedArrayList()
+{
+    clear();
+    for (pointer chunk : m_chunks)
+    {
+        alloc_traits::deallocate(m_alloc, chunk, ChunkSize);
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function at
+/// @param    index    holds index to specified element
+/// @return   Returns a reference to the element at the specified index.
+/// @note Throws std::out_of_range for an index past size().
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t ChunkSize, class Allocator>
+typename SegmentedArrayList<T, ChunkSize, Allocator>::reference
+SegmentedArrayList<T, ChunkSize, Allocator>::at(size_type index)
+{
+    if (index >= m_size)
+    {
+        throw std::out_of_range{ "Accessed position is out of range!" };
+    }
+    return (*this)[index];
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+typename SegmentedArrayList<T, ChunkSize, Allocator>::const_reference
+SegmentedArrayList<T, ChunkSize, Allocator>::at(size_type index) const
+{
+    if (index >= m_size)
+    {
+        throw std::out_of_range{ "Accessed position is out of range!" };
+    }
+    return (*this)[index];
+}
+
+/// ----------------------------------------------------------------------
+/// @function chunk
+/// @param    index    holds index of the chunk
+/// @return   Returns the elements of the chunk as a contiguous span.
+///           Every chunk but the last is full.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t ChunkSize, class Allocator>
+std::span<T> SegmentedArrayList<T, ChunkSize, Allocator>::chunk(size_type index) noexcept
+{
+    return { m_chunks[index], std::min(ChunkSize, m_size - index * ChunkSize) };
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+std::span<const T> SegmentedArrayList<T, ChunkSize, Allocator>::chunk(size_type index) const noexcept
+{
+    return { m_chunks[index], std::min(ChunkSize, m_size - index * ChunkSize) };
+}
+
+/// ----------------------------------------------------------------------
+/// @function reserve
+/// @param    new_cap     holds the minimum capacity
+/// @note Allocates chunks until new_cap elements fit.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t ChunkSize, class Allocator>
+void SegmentedArrayList<T, ChunkSize, Allocator>::reserve(size_type new_cap)
+{
+    m_chunks.reserve((new_cap + ChunkSize - 1) / ChunkSize);
+    while (capacity() < new_cap)
+    {
+        add_chunk();
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function shrink_to_fit
+/// @note Frees the chunks past the last element.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t ChunkSize, class Allocator>
+void SegmentedArrayList<T, ChunkSize, Allocator>::shrink_to_fit() noexcept
+{
+    for (size_type index = chunk_count(); index < m_chunks.size(); ++index)
+    {
+        alloc_traits::deallocate(m_alloc, m_chunks[index], ChunkSize);
+    }
+    m_chunks.resize(chunk_count());
+}
+
+/// ----------------------------------------------------------------------
+/// @function clear
+/// @note Destroys the elements and keeps the chunks.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t ChunkSize, class Allocator>
+void SegmentedArrayList<T, ChunkSize, Allocator>::clear() noexcept
+{
+    if constexpr (!std::is_trivially_destructible_v<T>)
+    {
+        for (size_type index = 0; index < chunk_count(); ++index)
+        {
+            for (value_type& item : chunk(index))
+            {
+                alloc_traits::destroy(m_alloc, std::addressof(item));
+            }
+        }
+    }
+    m_size = 0;
+}
+
+/// ----------------------------------------------------------------------
+/// @function emplace_back
+/// @param    args     holds the arguments to construct the element with
+/// @return   Returns a reference to the new element.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t ChunkSize, class Allocator>
+template <class... Args>
+typename SegmentedArrayList<T, ChunkSize, Allocator>::reference
+SegmentedArrayList<T, ChunkSize, Allocator>::emplace_back(Args&&... args)
+{
+    if (m_size == capacity())
+    {
+        add_chunk();
+    }
+
+    pointer slot = m_chunks[m_size / ChunkSize] + m_size % ChunkSize;
+    alloc_traits::construct(m_alloc, slot, std::forward<Args>(args)...);
+    ++m_size;
+    return *slot;
+}
+
+/// ----------------------------------------------------------------------
+/// @function pop_back
+/// @note Destroys the last element; the chunk is kept for reuse.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t ChunkSize, class Allocator>
+void SegmentedArrayList<T, ChunkSize, Allocator>::pop_back()
+{
+    if (m_size == 0)
+    {
+        throw std::out_of_range{ "Accessed position is out of range!" };
+    }
+    --m_size;
+    alloc_traits::destroy(m_alloc, std::addressof((*this)[m_size]));
+}
+
+/// ----------------------------------------------------------------------
+/// @function resize
+/// @param    count    holds the new size
+/// @param    value    holds the value to copy into added elements
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t ChunkSize, class Allocator>
+void SegmentedArrayList<T, ChunkSize, Allocator>::resize(size_type count)
+{
+    grow_to(count, [this](pointer slot) { alloc_traits::construct(m_alloc, slot); });
+}
+
+template <class T, std::size_t ChunkSize, class Allocator>
+void SegmentedArrayList<T, ChunkSize, Allocator>::resize(size_type count, const value_type& value)
+{
+    grow_to(count, [this, &value](pointer slot) { alloc_traits::construct(m_alloc, slot, value); });
+}
+
+/// ----------------------------------------------------------------------
+/// @function swap
+/// @param    other    holds the container to exchange contents with
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t ChunkSize, class Allocator>
+void SegmentedArrayList<T, ChunkSize, Allocator>::swap(SegmentedArrayList& other) noexcept
+{
+    m_chunks.swap(other.m_chunks);
+    std::swap(m_size, other.m_size);
+    if constexpr (alloc_traits::propagate_on_container_swap::value)
+    {
+        std::swap(m_alloc, other.m_alloc);
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function operator=  </Copy and Move Assignment Operator/>
+/// @param    other      holds contents of source container
+/// @return   Returns a reference to this container.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t ChunkSize, class Allocator>
+SegmentedArrayList<T, ChunkSize, Allocator>&
+SegmentedArrayList<T, ChunkSize, Allocator>::operator=(SegmentedArrayList other) noexcept
+{
+    swap(other);
+    return *this;
+}
+
+/// ----------------------------------------------------------------------
+/// @function grow_to
+/// @param    count       holds the new size
+/// @param    construct   holds the callable building an element in a slot
+/// @note Shrinking destroys the elements past count.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t ChunkSize, class Allocator>
+template <class Construct>
+void SegmentedArrayList<T, ChunkSize, Allocator>::grow_to(size_type count, Construct&& construct)
+{
+    while (m_size > count)
+    {
+        pop_back();
+    }
+
+    reserve(count);
+    while (m_size < count)
+    {
+        construct(m_chunks[m_size / ChunkSize] + m_size % ChunkSize);
+        ++m_size;
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function add_chunk
+/// @note Allocates one chunk and appends it to the directory.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t ChunkSize, class Allocator>
+void SegmentedArrayList<T, ChunkSize, Allocator>::add_chunk()
+{
+    pointer chunk = alloc_traits::allocate(m_alloc, ChunkSize);
+    try
+    {
+        m_chunks.push_back(chunk);
+    }
+    catch (...)
+    {
+        alloc_traits::deallocate(m_alloc, chunk, ChunkSize);
+        throw;
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function operator==  </! Equality Operator !/>
+/// @param    lhs      holds the first container
+/// @param    rhs      holds the second container
+/// @return   Returns 'True' if both hold equal elements in the same order.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t ChunkSize, class Allocator>
+bool operator==(const SegmentedArrayList<T, ChunkSize, Allocator>& lhs,
+                const SegmentedArrayList<T, ChunkSize, Allocator>& rhs)
+{
+    if (lhs.size() != rhs.size())
+    {
+        return false;
+    }
+    for (std::size_t index = 0; index < lhs.chunk_count(); ++index)
+    {
+        const auto left  = lhs.chunk(index);
+        const auto right = rhs.chunk(index);
+        if (!std::equal(left.begin(), left.end(), right.begin()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// ----------------------------------------------------------------------
+/// @function operator<<  </! Stream Insertion Operator !/>
+/// @param    output      Output stream where data is sent
+/// @param    list        Object of the class
+/// @return   Allows objects to be formatted and sent to output streams.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t ChunkSize, class Allocator>
+std::ostream& operator<<(std::ostream& output, const SegmentedArrayList<T, ChunkSize, Allocator>& list)
+{
+    char separator[2]{};
+
+    output << '{';
+
+    for (const T& item : list) {
+        output << separator << item;
+        *separator = ',';
+    }
+
+    return output << '}';
+}
+
+} // namespace AL
+
+#endif /* SegmentedArrayList_hpp */
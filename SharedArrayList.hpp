@@ -0,0 +1,782 @@
+/// @author - Brandon Wallace
+/// @file - SharedArrayList.hpp
+/// @brief - The SharedArrayList is an ArrayList with reference-counted,
+/// copy-on-write storage: copies and snapshots take O(1) and share the
+/// elements until one of them is modified.
+
+#ifndef SharedArrayList_hpp
+#define SharedArrayList_hpp
+
+/// C++ Standard Library Header Files
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/// User Defined Header Files
+#include "ArrayList.hpp"
+
+namespace AL {
+
+namespace detail {
+
+/// ----------------------------------------------------------------------
+/// @struct   SharedBlock
+/// @note Reference count, sizes and elements of a SharedArrayList in one
+/// allocation. 'size' counts the constructed elements; every holder of
+/// the block keeps its own length, which may be shorter.
+/// ----------------------------------------------------------------------
+
+template <class T>
+struct SharedBlock {
+    std::atomic<std::size_t> refs{ 1 };
+    std::atomic<std::size_t> size{ 0 };
+    std::size_t              capacity = 0;
+
+    static constexpr std::size_t alignment = std::max(alignof(T), alignof(std::atomic<std::size_t>));
+    static constexpr std::size_t offset    = (sizeof(std::atomic<std::size_t>) * 2 + sizeof(std::size_t) +
+                                              alignof(T) - 1) / alignof(T) * alignof(T);
+
+    T* elements() noexcept
+    {
+        return std::launder(reinterpret_cast<T*>(reinterpret_cast<std::byte*>(this) + offset));
+    }
+
+    static SharedBlock* create(std::size_t capacity)
+    {
+        if (capacity > (std::numeric_limits<std::size_t>::max() - offset) / sizeof(T))
+        {
+            throw std::length_error{ "SharedArrayList capacity is too large!" };
+        }
+
+        void* memory = ::operator new(offset + capacity * sizeof(T), std::align_val_t{ alignment });
+        auto* block  = ::new (memory) SharedBlock;
+        block->capacity = capacity;
+        return block;
+    }
+
+    static void retain(SharedBlock* block) noexcept
+    {
+        if (block)
+        {
+            block->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    static void release(SharedBlock* block) noexcept
+    {
+        if (block && block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            std::destroy_n(block->elements(), block->size.load(std::memory_order_relaxed));
+            block->~SharedBlock();
+            ::operator delete(block, std::align_val_t{ alignment });
+        }
+    }
+};
+
+} // namespace detail
+
+/// ----------------------------------------------------------------------
+/// @class    SharedArrayList
+/// @note Copies share the storage through an atomic reference count. A
+/// modification first detaches, i.e. copies the elements into storage of
+/// its own, unless nobody else holds the storage. Appending is cheaper
+/// still: a holder at the end of the constructed elements claims the next
+/// free slot with a compare-exchange and writes there in place, since no
+/// other holder looks past its own length. A writer that keeps appending
+/// after handing out snapshots therefore copies only when it runs out of
+/// capacity.
+///
+/// Reading through a const SharedArrayList never detaches. The non-const
+/// overloads of operator[], at, front, back, data, begin and end do, since
+/// they allow writes; use std::as_const or cbegin to read without paying
+/// for a copy. Distinct SharedArrayList and Snapshot objects may be used
+/// from different threads even when they share storage, like
+/// std::shared_ptr.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy = DoublingGrowth>
+class SharedArrayList {
+public:
+    typedef T                 value_type;
+    typedef std::size_t       size_type;
+    typedef std::ptrdiff_t    difference_type;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef pointer           iterator;
+    typedef const_pointer     const_iterator;
+
+    class Snapshot;
+
+    /// ----------------------------------------------------------------------
+    /// @function SharedArrayList  </Default Constructor/>
+    /// ----------------------------------------------------------------------
+
+    SharedArrayList() noexcept = default;
+
+    /// ----------------------------------------------------------------------
+    /// @function SharedArrayList
+    /// @param    count       holds the number of elements
+    /// @param    value       holds the value to copy into each element
+    /// ----------------------------------------------------------------------
+
+    explicit SharedArrayList(size_type count) { resize(count); }
+    SharedArrayList(size_type count, const value_type& value) { resize(count, value); }
+
+    /// ----------------------------------------------------------------------
+    /// @function SharedArrayList
+    /// @param    init_list   holds the elements to copy
+    /// ----------------------------------------------------------------------
+
+    SharedArrayList(std::initializer_list<value_type> init_list)
+        : SharedArrayList(init_list.begin(), init_list.end()) {}
+
+    /// ----------------------------------------------------------------------
+    /// @function SharedArrayList
+    /// @param    first       holds the beginning of the range to copy
+    /// @param    last        holds the end of the range to copy
+    /// ----------------------------------------------------------------------
+
+    template <std::forward_iterator ForwardIt>
+    SharedArrayList(ForwardIt first, ForwardIt last);
+
+    /// ----------------------------------------------------------------------
+    /// @function SharedArrayList
+    /// @param    list        holds the ArrayList to copy
+    /// ----------------------------------------------------------------------
+
+    template <class G, class A, std::size_t N, class S, class C>
+    explicit SharedArrayList(const BasicArrayList<T, G, A, N, S, C>& list)
+        : SharedArrayList(list.begin(), list.end()) {}
+
+    /// ----------------------------------------------------------------------
+    /// @function SharedArrayList  </Copy Constructor/>
+    /// @param    other       holds contents of source container
+    /// @note Shares the storage of other; O(1).
+    /// ----------------------------------------------------------------------
+
+    SharedArrayList(const SharedArrayList& other) noexcept
+        : m_block(other.m_block), m_size(other.m_size)
+    {
+        detail::SharedBlock<T>::retain(m_block);
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @function SharedArrayList  </Move Constructor/>
+    /// @param    other       holds contents of source container
+    /// ----------------------------------------------------------------------
+
+    SharedArrayList(SharedArrayList&& other) noexcept
+        : m_block(std::exchange(other.m_block, nullptr)), m_size(std::exchange(other.m_size, 0)) {}
+
+    /// ----------------------------------------------------------------------
+    /// @function ~SharedArrayList  </Destructor/>
+    /// @note The elements are destroyed with the last holder of the storage.
+    /// ----------------------------------------------------------------------
+
+    ~SharedArrayList() { detail::SharedBlock<T>::release(m_block); }
+
+    //! *** Element Access *** !//
+
+    /// ----------------------------------------------------------------------
+    /// @function at
+    /// @param    index    holds index to specified element
+    /// @return   Returns a reference to the element at the specified index.
+    /// @note Throws std::out_of_range for an index past size(). The
+    /// non-const overload detaches.
+    /// ----------------------------------------------------------------------
+
+    reference       at(size_type index);
+    const_reference at(size_type index) const;
+
+    reference       front()       { return at(0); }
+    const_reference front() const { return at(0); }
+    reference       back()        { return at(m_size - 1); }
+    const_reference back() const  { return at(m_size - 1); }
+
+    pointer       data()       { detach(); return elements(); }
+    const_pointer data() const noexcept { return elements(); }
+
+    iterator       begin()       { detach(); return elements(); }
+    const_iterator begin() const noexcept  { return elements(); }
+    const_iterator cbegin() const noexcept { return elements(); }
+    iterator       end()         { detach(); return elements() + m_size; }
+    const_iterator end() const noexcept    { return elements() + m_size; }
+    const_iterator cend() const noexcept   { return elements() + m_size; }
+
+    //! *** Capacity *** !//
+
+    bool      empty() const noexcept    { return m_size == 0; }
+    size_type size() const noexcept     { return m_size; }
+    size_type capacity() const noexcept { return m_block ? m_block->capacity : 0; }
+
+    /// ----------------------------------------------------------------------
+    /// @function use_count
+    /// @return   Returns the number of lists and snapshots sharing the
+    ///           storage, 0 when there is none.
+    /// ----------------------------------------------------------------------
+
+    size_type use_count() const noexcept
+    {
+        return m_block ? m_block->refs.load(std::memory_order_relaxed) : 0;
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @function reserve
+    /// @param    new_cap     holds the minimum capacity
+    /// ----------------------------------------------------------------------
+
+    void reserve(size_type new_cap)
+    {
+        if (new_cap > capacity())
+        {
+            make_exclusive(new_cap);
+        }
+    }
+
+    //! *** Modifiers *** !//
+
+    /// ----------------------------------------------------------------------
+    /// @function snapshot
+    /// @return   Returns an immutable view of the current elements. It
+    ///           shares the storage and stays valid and unchanged whatever
+    ///           is done to this list afterwards.
+    /// ----------------------------------------------------------------------
+
+    Snapshot snapshot() const noexcept { return Snapshot(m_block, m_size); }
+
+    /// ----------------------------------------------------------------------
+    /// @function to_list
+    /// @return   Returns an ArrayList holding a copy of the elements.
+    /// ----------------------------------------------------------------------
+
+    ArrayList<T> to_list() const { return ArrayList<T>(cbegin(), cend()); }
+
+    /// ----------------------------------------------------------------------
+    /// @function clear
+    /// @note Lets go of shared storage instead of copying it.
+    /// ----------------------------------------------------------------------
+
+    void clear() noexcept;
+
+    /// ----------------------------------------------------------------------
+    /// @function push_back
+    /// @param    value    holds the value to append
+    /// ----------------------------------------------------------------------
+
+    void push_back(const value_type& value) { emplace_back(value); }
+    void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+    /// ----------------------------------------------------------------------
+    /// @function emplace_back
+    /// @param    args     holds the arguments to construct the element with
+    /// @return   Returns a reference to the new element.
+    /// @note Appends in place, without detaching, while this list holds the
+    /// last constructed element and the storage has room.
+    /// ----------------------------------------------------------------------
+
+    template <class... Args>
+    reference emplace_back(Args&&... args);
+
+    /// ----------------------------------------------------------------------
+    /// @function pop_back
+    /// @note Shared storage is left alone; only this list gets shorter.
+    /// ----------------------------------------------------------------------
+
+    void pop_back();
+
+    /// ----------------------------------------------------------------------
+    /// @function insert
+    /// @param    pos      holds the position to insert before
+    /// @param    value    holds the value to insert
+    /// @return   Returns an iterator pointing to the inserted element.
+    /// ----------------------------------------------------------------------
+
+    iterator insert(const_iterator pos, value_type value);
+
+    /// ----------------------------------------------------------------------
+    /// @function erase
+    /// @param    pos      holds the position of the element to remove
+    /// @return   Returns an iterator following the removed element.
+    /// ----------------------------------------------------------------------
+
+    iterator erase(const_iterator pos);
+
+    /// ----------------------------------------------------------------------
+    /// @function resize
+    /// @param    count    holds the new size
+    /// @param    value    holds the value to copy into added elements
+    /// ----------------------------------------------------------------------
+
+    void resize(size_type count);
+    void resize(size_type count, const value_type& value);
+
+    /// ----------------------------------------------------------------------
+    /// @function swap
+    /// @param    other    holds the container to exchange contents with
+    /// ----------------------------------------------------------------------
+
+    void swap(SharedArrayList& other) noexcept
+    {
+        std::swap(m_block, other.m_block);
+        std::swap(m_size, other.m_size);
+    }
+
+    //! *** Operators *** !//
+
+    /// ----------------------------------------------------------------------
+    /// @function operator=  </Copy and Move Assignment Operator/>
+    /// @param    other      holds contents of source container
+    /// @return   Returns a reference to this container.
+    /// @note Copy assignment shares the storage of other; O(1).
+    /// ----------------------------------------------------------------------
+
+    SharedArrayList& operator=(SharedArrayList other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @function operator[]
+    /// @param    index    holds index to specified element
+    /// @return   Returns a reference to the element at the specified index.
+    /// @note The non-const overload detaches.
+    /// ----------------------------------------------------------------------
+
+    reference       operator[](size_type index)                { detach(); return elements()[index]; }
+    const_reference operator[](size_type index) const noexcept { return elements()[index]; }
+
+private:
+    using block_type = detail::SharedBlock<T>;
+
+    pointer elements() const noexcept { return m_block ? m_block->elements() : nullptr; }
+
+    bool exclusive() const noexcept { return m_block && m_block->refs.load(std::memory_order_acquire) == 1; }
+
+    void detach()
+    {
+        if (!exclusive() || m_block->size.load(std::memory_order_relaxed) != m_size)
+        {
+            make_exclusive(std::max(m_size, capacity()));
+        }
+    }
+
+    void make_exclusive(size_type min_capacity);
+
+    size_type next_capacity(size_type required) const
+    {
+        return GrowthPolicy::next_capacity(capacity(), required, sizeof(T));
+    }
+
+    block_type* m_block = nullptr;
+    size_type   m_size  = 0;
+};
+
+/// ----------------------------------------------------------------------
+/// @class    Snapshot
+/// @note Read-only list sharing the storage of the SharedArrayList it was
+/// taken from, frozen at the length it had then.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+class SharedArrayList<T, GrowthPolicy>::Snapshot {
+public:
+    typedef T                 value_type;
+    typedef std::size_t       size_type;
+    typedef const value_type& const_reference;
+    typedef const value_type* const_pointer;
+    typedef const value_type* const_iterator;
+    typedef const_iterator    iterator;
+
+    Snapshot() noexcept = default;
+
+    Snapshot(const Snapshot& other) noexcept : m_block(other.m_block), m_size(other.m_size)
+    {
+        block_type::retain(m_block);
+    }
+
+    Snapshot(Snapshot&& other) noexcept
+        : m_block(std::exchange(other.m_block, nullptr)), m_size(std::exchange(other.m_size, 0)) {}
+
+    Snapshot& operator=(Snapshot other) noexcept
+    {
+        std::swap(m_block, other.m_block);
+        std::swap(m_size, other.m_size);
+        return *this;
+    }
+
+    ~Snapshot() { block_type::release(m_block); }
+
+    const_reference at(size_type index) const
+    {
+        if (index >= m_size)
+        {
+            throw std::out_of_range{ "Accessed position is out of range!" };
+        }
+        return data()[index];
+    }
+
+    const_pointer  data() const noexcept  { return m_block ? m_block->elements() : nullptr; }
+    const_iterator begin() const noexcept { return data(); }
+    const_iterator end() const noexcept   { return data() + m_size; }
+
+    bool      empty() const noexcept { return m_size == 0; }
+    size_type size() const noexcept  { return m_size; }
+
+    const_reference operator[](size_type index) const noexcept { return data()[index]; }
+
+private:
+    friend class SharedArrayList;
+
+    Snapshot(block_type* block, size_type size) noexcept : m_block(block), m_size(size)
+    {
+        block_type::retain(m_block);
+    }
+
+    block_type* m_block = nullptr;
+    size_type   m_size  = 0;
+};
+
+//! ******************* D E F I N I T I O N S ************************ !//
+
+/// ----------------------------------------------------------------------
+/// @function SharedArrayList
+/// @param    first       holds the beginning of the range to copy
+/// @param    last        holds the end of the range to copy
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+template <std::forward_iterator ForwardIt>
+SharedArrayList<T, GrowthPolicy>::SharedArrayList(ForwardIt first, ForwardIt last)
+{
+    const auto count = static_cast<size_type>(std::distance(first, last));
+    if (count == 0)
+    {
+        return;
+    }
+
+    m_block = block_type::create(count);
+    try
+    {
+        std::uninitialized_copy(first, last, m_block->elements());
+    }
+    catch (...)
+    {
+        block_type::release(m_block);
+        throw;
+    }
+    m_block->size.store(count, std::memory_order_relaxed);
+    m_size = count;
+}
+
+/// ----------------------------------------------------------------------
+/// @function at
+/// @param    index    holds index to specified element
+/// @return   Returns a reference to the element at the specified index.
+/// @note Throws std::out_of_range for an index past size(). The
+/// non-const overload detaches.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+typename SharedArrayList<T, GrowthPolicy>::reference
+SharedArrayList<T, GrowthPolicy>::at(size_type index)
+{
+    if (index >= m_size)
+    {
+        throw std::out_of_range{ "Accessed position is out of range!" };
+    }
+    return (*this)[index];
+}
+
+template <class T, class GrowthPolicy>
+typename SharedArrayList<T, GrowthPolicy>::const_reference
+SharedArrayList<T, GrowthPolicy>::at(size_type index) const
+{
+    if (index >= m_size)
+    {
+        throw std::out_of_range{ "Accessed position is out of range!" };
+    }
+    return (*this)[index];
+}
+
+/// ----------------------------------------------------------------------
+/// @function clear
+/// @note Lets go of shared storage instead of copying it.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+void SharedArrayList<T, GrowthPolicy>::clear() noexcept
+{
+    if (exclusive())
+    {
+        std::destroy_n(m_block->elements(), m_block->size.load(std::memory_order_relaxed));
+        m_block->size.store(0, std::memory_order_relaxed);
+    }
+    else
+    {
+        block_type::release(std::exchange(m_block, nullptr));
+    }
+    m_size = 0;
+}
+
+/// ----------------------------------------------------------------------
+/// @function emplace_back
+/// @param    args     holds the arguments to construct the element with
+/// @return   Returns a reference to the new element.
+/// @note Appends in place, without detaching, while this list holds the
+/// last constructed element and the storage has room.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+template <class... Args>
+typename SharedArrayList<T, GrowthPolicy>::reference
+SharedArrayList<T, GrowthPolicy>::emplace_back(Args&&... args)
+{
+    if (m_size < capacity())
+    {
+        if (exclusive())
+        {
+            detach();
+            std::construct_at(m_block->elements() + m_size, std::forward<Args>(args)...);
+            m_block->size.store(m_size + 1, std::memory_order_relaxed);
+            return m_block->elements()[m_size++];
+        }
+
+        // the other holders only read up to their own, shorter, lengths
+        size_type expected = m_size;
+        if (m_block->size.compare_exchange_strong(expected, m_size + 1, std::memory_order_acq_rel))
+        {
+            try
+            {
+                std::construct_at(m_block->elements() + m_size, std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                m_block->size.store(m_size, std::memory_order_release);
+                throw;
+            }
+            return m_block->elements()[m_size++];
+        }
+    }
+
+    // make_exclusive may copy the shared block or free it once this list
+    // lets go, and args can point into it, so the value is taken first
+    value_type value(std::forward<Args>(args)...);
+    make_exclusive(m_size < capacity() ? capacity() : next_capacity(m_size + 1));
+
+    std::construct_at(m_block->elements() + m_size, std::move(value));
+    m_block->size.store(m_size + 1, std::memory_order_relaxed);
+    return m_block->elements()[m_size++];
+}
+
+/// ----------------------------------------------------------------------
+/// @function pop_back
+/// @note Shared storage is left alone; only this list gets shorter.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+void SharedArrayList<T, GrowthPolicy>::pop_back()
+{
+    if (m_size == 0)
+    {
+        throw std::out_of_range{ "Accessed position is out of range!" };
+    }
+    if (exclusive() && m_block->size.load(std::memory_order_relaxed) == m_size)
+    {
+        std::destroy_at(m_block->elements() + m_size - 1);
+        m_block->size.store(m_size - 1, std::memory_order_relaxed);
+    }
+    --m_size;
+}
+
+/// ----------------------------------------------------------------------
+/// @function insert
+/// @param    pos      holds the position to insert before
+/// @param    value    holds the value to insert
+/// @return   Returns an iterator pointing to the inserted element.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+typename SharedArrayList<T, GrowthPolicy>::iterator
+SharedArrayList<T, GrowthPolicy>::insert(const_iterator pos, value_type value)
+{
+    const auto offset = static_cast<size_type>(pos - cbegin());
+    if (offset > m_size)
+    {
+        throw std::out_of_range{ "Accessed position is out of range!" };
+    }
+
+    make_exclusive(m_size < capacity() ? capacity() : next_capacity(m_size + 1));
+    emplace_back(std::move(value));
+    std::rotate(elements() + offset, elements() + m_size - 1, elements() + m_size);
+    return elements() + offset;
+}
+
+/// ----------------------------------------------------------------------
+/// @function erase
+/// @param    pos      holds the position of the element to remove
+/// @return   Returns an iterator following the removed element.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+typename SharedArrayList<T, GrowthPolicy>::iterator
+SharedArrayList<T, GrowthPolicy>::erase(const_iterator pos)
+{
+    const auto offset = static_cast<size_type>(pos - cbegin());
+    if (offset >= m_size)
+    {
+        throw std::out_of_range{ "Accessed position is out of range!" };
+    }
+
+    detach();
+    std::move(elements() + offset + 1, elements() + m_size, elements() + offset);
+    pop_back();
+    return elements() + offset;
+}
+
+/// ----------------------------------------------------------------------
+/// @function resize
+/// @param    count    holds the new size
+/// @param    value    holds the value to copy into added elements
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+void SharedArrayList<T, GrowthPolicy>::resize(size_type count)
+{
+    if (count > m_size)
+    {
+        reserve(count);
+    }
+    while (m_size > count)
+    {
+        pop_back();
+    }
+    while (m_size < count)
+    {
+        emplace_back();
+    }
+}
+
+template <class T, class GrowthPolicy>
+void SharedArrayList<T, GrowthPolicy>::resize(size_type count, const value_type& value)
+{
+    if (count > m_size)
+    {
+        // value may be an element, keep a copy across the reallocation
+        const value_type fill = value;
+        reserve(count);
+        while (m_size < count)
+        {
+            emplace_back(fill);
+        }
+    }
+    while (m_size > count)
+    {
+        pop_back();
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function make_exclusive
+/// @param    min_capacity   holds the capacity the storage must have
+/// @note Leaves this list the only holder of storage whose constructed
+/// elements are exactly its own. Shared storage is copied; storage held
+/// alone is trimmed and, if too small, moved to a larger block.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+void SharedArrayList<T, GrowthPolicy>::make_exclusive(size_type min_capacity)
+{
+    const bool alone = exclusive();
+
+    if (alone)
+    {
+        // drop what other holders appended before letting go
+        const size_type constructed = m_block->size.load(std::memory_order_relaxed);
+        std::destroy(m_block->elements() + m_size, m_block->elements() + constructed);
+        m_block->size.store(m_size, std::memory_order_relaxed);
+
+        if (min_capacity <= m_block->capacity)
+        {
+            return;
+        }
+    }
+
+    const size_type new_cap = std::max(min_capacity, m_size);
+    if (new_cap == 0)
+    {
+        block_type::release(std::exchange(m_block, nullptr));
+        return;
+    }
+
+    block_type* fresh = block_type::create(new_cap);
+    try
+    {
+        if (alone && (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>))
+        {
+            std::uninitialized_move_n(m_block->elements(), m_size, fresh->elements());
+        }
+        else
+        {
+            std::uninitialized_copy_n(elements(), m_size, fresh->elements());
+        }
+    }
+    catch (...)
+    {
+        block_type::release(fresh);
+        throw;
+    }
+
+    fresh->size.store(m_size, std::memory_order_relaxed);
+    block_type::release(std::exchange(m_block, fresh));
+}
+
+/// ----------------------------------------------------------------------
+/// @function operator==  </! Equality Operator !/>
+/// @param    lhs      holds the first container
+/// @param    rhs      holds the second container
+/// @return   Returns 'True' if both hold equal elements in the same order.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+bool operator==(const SharedArrayList<T, GrowthPolicy>& lhs, const SharedArrayList<T, GrowthPolicy>& rhs)
+{
+    return std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+}
+
+/// ----------------------------------------------------------------------
+/// @function operator<<  </! Stream Insertion Operator !/>
+/// @param    output      Output stream where data is sent
+/// @param    list        Object of the class
+/// @return   Allows objects to be formatted and sent to output streams.
+/// ----------------------------------------------------------------------
+
+template <class T, class GrowthPolicy>
+std::ostream& operator<<(std::ostream& output, const SharedArrayList<T, GrowthPolicy>& list)
+{
+    char separator[2]{};
+
+    output << '{';
+
+    for (auto it = list.cbegin(); it != list.cend(); ++it) {
+        output << separator << *it;
+        *separator = ',';
+    }
+
+    return output << '}';
+}
+
+} // namespace AL
+
+#endif /* SharedArrayList_hpp */
@@ -0,0 +1,501 @@
+/// @author - Brandon Wallace
+/// @file - SoAArrayList.hpp
+/// @brief - The SoAArrayList stores rows of Fields... as a structure of
+/// arrays: one aligned, contiguous column per field, so a loop touching a
+/// few fields only loads those fields.
+
+#ifndef SoAArrayList_hpp
+#define SoAArrayList_hpp
+
+/// C++ Standard Library Header Files
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/// User Defined Header Files
+#include "ArrayList.hpp"
+
+namespace AL {
+
+namespace detail {
+
+/// Upper bound on the fields a row struct is unpacked into.
+inline constexpr std::size_t soa_max_fields = 12;
+
+/// A row given as a struct or tuple-like type of N members, in order.
+template <class Row, std::size_t N>
+concept soa_row = std::is_aggregate_v<std::remove_cvref_t<Row>> ||
+                  requires { requires std::tuple_size<std::remove_cvref_t<Row>>::value == N; };
+
+/// ----------------------------------------------------------------------
+/// @function soa_tie
+/// @param    row      holds a struct or tuple-like row of N members
+/// @return   Returns a tuple of references to the members of row.
+/// ----------------------------------------------------------------------
+
+template <std::size_t N, class Row>
+auto soa_tie(Row& row)
+{
+    static_assert(N <= soa_max_fields, "SoAArrayList unpacks rows of at most 12 fields");
+
+    if constexpr (N == 1)
+    {
+        auto& [a] = row;
+        return std::tie(a);
+    }
+    else if constexpr (N == 2)
+    {
+        auto& [a, b] = row;
+        return std::tie(a, b);
+    }
+    else if constexpr (N == 3)
+    {
+        auto& [a, b, c] = row;
+        return std::tie(a, b, c);
+    }
+    else if constexpr (N == 4)
+    {
+        auto& [a, b, c, d] = row;
+        return std::tie(a, b, c, d);
+    }
+    else if constexpr (N == 5)
+    {
+        auto& [a, b, c, d, e] = row;
+        return std::tie(a, b, c, d, e);
+    }
+    else if constexpr (N == 6)
+    {
+        auto& [a, b, c, d, e, f] = row;
+        return std::tie(a, b, c, d, e, f);
+    }
+    else if constexpr (N == 7)
+    {
+        auto& [a, b, c, d, e, f, g] = row;
+        return std::tie(a, b, c, d, e, f, g);
+    }
+    else if constexpr (N == 8)
+    {
+        auto& [a, b, c, d, e, f, g, h] = row;
+        return std::tie(a, b, c, d, e, f, g, h);
+    }
+    else if constexpr (N == 9)
+    {
+        auto& [a, b, c, d, e, f, g, h, i] = row;
+        return std::tie(a, b, c, d, e, f, g, h, i);
+    }
+    else if constexpr (N == 10)
+    {
+        auto& [a, b, c, d, e, f, g, h, i, j] = row;
+        return std::tie(a, b, c, d, e, f, g, h, i, j);
+    }
+    else if constexpr (N == 11)
+    {
+        auto& [a, b, c, d, e, f, g, h, i, j, k] = row;
+        return std::tie(a, b, c, d, e, f, g, h, i, j, k);
+    }
+    else
+    {
+        auto& [a, b, c, d, e, f, g, h, i, j, k, l] = row;
+        return std::tie(a, b, c, d, e, f, g, h, i, j, k, l);
+    }
+}
+
+} // namespace detail
+
+/// ----------------------------------------------------------------------
+/// @class    BasicSoAArrayList
+/// @note Each field lives in its own BasicArrayList column, allocated on
+/// an Alignment-byte boundary. The columns grow together: the capacity is
+/// picked by GrowthPolicy from the size of a whole row and reserved in
+/// every column, so they keep the same length and capacity.
+///
+/// Rows go in as separate field values, a std::tuple, or any struct or
+/// tuple-like type whose members are Fields... in order, e.g.
+/// 'struct Particle { float x, y; int id; }' for
+/// SoAArrayList<float, float, int>. column<I>() exposes field I as a
+/// std::span for vectorized loops; row-wise code goes through operator[]
+/// and the iterators, whose reference is a std::tuple of references to
+/// the fields of one row.
+/// ----------------------------------------------------------------------
+
+template <class GrowthPolicy, std::size_t Alignment, class... Fields>
+class BasicSoAArrayList {
+    static_assert(sizeof...(Fields) > 0, "SoAArrayList needs at least one field");
+
+    template <bool Const>
+    class Iterator;
+
+public:
+    typedef std::tuple<Fields...>        value_type;
+    typedef std::tuple<Fields&...>       reference;
+    typedef std::tuple<const Fields&...> const_reference;
+    typedef std::size_t                  size_type;
+    typedef std::ptrdiff_t               difference_type;
+    typedef Iterator<false>              iterator;
+    typedef Iterator<true>               const_iterator;
+
+    template <std::size_t I>
+    using field_type = std::tuple_element_t<I, value_type>;
+
+    template <class Field>
+    using column_type = BasicArrayList<Field, GrowthPolicy, AlignedAllocator<Field, Alignment>>;
+
+    static constexpr std::size_t field_count = sizeof...(Fields);
+
+    /// ----------------------------------------------------------------------
+    /// @function BasicSoAArrayList  </Default Constructor/>
+    /// ----------------------------------------------------------------------
+
+    BasicSoAArrayList() = default;
+
+    //! *** Element Access *** !//
+
+    /// ----------------------------------------------------------------------
+    /// @function column
+    /// @return   Returns the contiguous, Alignment-aligned elements of
+    ///           field I, one per row.
+    /// ----------------------------------------------------------------------
+
+    template <std::size_t I>
+    std::span<field_type<I>> column() noexcept
+    {
+        auto& list = std::get<I>(m_columns);
+        return { list.data(), list.size() };
+    }
+
+    template <std::size_t I>
+    std::span<const field_type<I>> column() const noexcept
+    {
+        const auto& list = std::get<I>(m_columns);
+        return { list.data(), list.size() };
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @function at
+    /// @param    index    holds index to specified row
+    /// @return   Returns references to the fields of the row at index.
+    /// @note Throws std::out_of_range for an index past size().
+    /// ----------------------------------------------------------------------
+
+    reference at(size_type index)
+    {
+        check_index(index);
+        return (*this)[index];
+    }
+
+    const_reference at(size_type index) const
+    {
+        check_index(index);
+        return (*this)[index];
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @function row
+    /// @param    index    holds index to specified row
+    /// @return   Returns a copy of the row at index as Row, built from the
+    ///           fields in order, e.g. a struct or std::tuple.
+    /// ----------------------------------------------------------------------
+
+    template <class Row = value_type>
+    Row row(size_type index) const
+    {
+        check_index(index);
+        return std::apply([index](const auto&... list) { return Row{ list[index]... }; }, m_columns);
+    }
+
+    reference       front()       { return at(0); }
+    const_reference front() const { return at(0); }
+    reference       back()        { return at(size() - 1); }
+    const_reference back() const  { return at(size() - 1); }
+
+    iterator       begin() noexcept        { return iterator(pointers(), 0); }
+    const_iterator begin() const noexcept  { return const_iterator(pointers(), 0); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    iterator       end() noexcept          { return iterator(pointers(), size()); }
+    const_iterator end() const noexcept    { return const_iterator(pointers(), size()); }
+    const_iterator cend() const noexcept   { return end(); }
+
+    //! *** Capacity *** !//
+
+    bool      empty() const noexcept { return size() == 0; }
+    size_type size() const noexcept  { return std::get<0>(m_columns).size(); }
+
+    /// ----------------------------------------------------------------------
+    /// @function capacity
+    /// @return   Returns the number of rows every column has room for.
+    /// ----------------------------------------------------------------------
+
+    size_type capacity() const noexcept
+    {
+        return std::apply([](const auto&... list) { return std::min({ list.capacity()... }); }, m_columns);
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @function reserve
+    /// @param    new_capacity    holds the minimum number of rows
+    /// ----------------------------------------------------------------------
+
+    void reserve(size_type new_capacity)
+    {
+        std::apply([new_capacity](auto&... list) { (list.reserve(new_capacity), ...); }, m_columns);
+    }
+
+    void shrink_to_fit()
+    {
+        std::apply([](auto&... list) { (list.shrink_to_fit(), ...); }, m_columns);
+    }
+
+    //! *** Modifiers *** !//
+
+    void clear() noexcept
+    {
+        std::apply([](auto&... list) { (list.clear(), ...); }, m_columns);
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @function push_back
+    /// @param    row      holds the row, a struct or tuple-like type whose
+    ///                    members are Fields... in order
+    /// @note Strong guarantee: if a field throws, no column is changed.
+    /// ----------------------------------------------------------------------
+
+    template <detail::soa_row<sizeof...(Fields)> Row>
+    void push_back(const Row& row)
+    {
+        if (size() == capacity())
+        {
+            // row may be one of ours, copy it before the columns move
+            value_type copy = detail::soa_tie<field_count>(row);
+            grow();
+            append(std::move(copy));
+        }
+        else
+        {
+            append(detail::soa_tie<field_count>(row));
+        }
+    }
+
+    void push_back(value_type&& row)
+    {
+        if (size() == capacity())
+        {
+            grow();
+        }
+        append(std::move(row));
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @function emplace_back
+    /// @param    fields   holds one constructor argument per field
+    /// @return   Returns references to the fields of the new row.
+    /// ----------------------------------------------------------------------
+
+    template <class... Args>
+    requires (sizeof...(Args) == sizeof...(Fields))
+    reference emplace_back(Args&&... fields)
+    {
+        if (size() == capacity())
+        {
+            value_type copy(std::forward<Args>(fields)...);
+            grow();
+            append(std::move(copy));
+        }
+        else
+        {
+            append(std::forward_as_tuple(std::forward<Args>(fields)...));
+        }
+        return (*this)[size() - 1];
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @function pop_back
+    /// @note Throws std::out_of_range when the container is empty.
+    /// ----------------------------------------------------------------------
+
+    void pop_back()
+    {
+        if (empty())
+        {
+            throw std::out_of_range{ "Accessed position is out of range!" };
+        }
+        std::apply([](auto&... list) { (list.erase(list.cend() - 1), ...); }, m_columns);
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @function resize
+    /// @param    count    holds the new number of rows
+    /// @note Added rows are value-initialized.
+    /// ----------------------------------------------------------------------
+
+    void resize(size_type count)
+    {
+        if (count > capacity())
+        {
+            reserve(count);
+        }
+        std::apply([count](auto&... list) { (list.resize(count), ...); }, m_columns);
+    }
+
+    void swap(BasicSoAArrayList& other) noexcept
+    {
+        m_columns.swap(other.m_columns);
+    }
+
+    //! *** Operators *** !//
+
+    /// ----------------------------------------------------------------------
+    /// @function operator[]
+    /// @param    index    holds index to specified row
+    /// @return   Returns references to the fields of the row at index.
+    /// ----------------------------------------------------------------------
+
+    reference operator[](size_type index) noexcept
+    {
+        return std::apply([index](auto&... list) { return reference(list.data()[index]...); }, m_columns);
+    }
+
+    const_reference operator[](size_type index) const noexcept
+    {
+        return std::apply([index](const auto&... list) { return const_reference(list.data()[index]...); }, m_columns);
+    }
+
+    friend bool operator==(const BasicSoAArrayList& lhs, const BasicSoAArrayList& rhs)
+    {
+        return lhs.m_columns == rhs.m_columns;
+    }
+
+private:
+    void check_index(size_type index) const
+    {
+        if (index >= size())
+        {
+            throw std::out_of_range{ "Accessed position is out of range!" };
+        }
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @function grow
+    /// @note Makes room for one more row in every column, growing them to
+    /// the capacity GrowthPolicy picks for rows of all the fields.
+    /// ----------------------------------------------------------------------
+
+    void grow()
+    {
+        reserve(GrowthPolicy::next_capacity(capacity(), size() + 1, (sizeof(Fields) + ...)));
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @function append
+    /// @param    row      holds a tuple of one argument per field
+    /// @note The columns must have room. Columns already appended to are
+    /// trimmed again if a later field throws.
+    /// ----------------------------------------------------------------------
+
+    template <class Tuple>
+    void append(Tuple&& row)
+    {
+        append_fields(std::forward<Tuple>(row), std::index_sequence_for<Fields...>{});
+    }
+
+    template <class Tuple, std::size_t... I>
+    void append_fields(Tuple&& row, std::index_sequence<I...>)
+    {
+        std::size_t appended = 0;
+
+        try
+        {
+            ((std::get<I>(m_columns).emplace_back(std::get<I>(std::forward<Tuple>(row))), ++appended), ...);
+        }
+        catch (...)
+        {
+            ((I < appended ? void(std::get<I>(m_columns).erase(std::get<I>(m_columns).cend() - 1)) : void()), ...);
+            throw;
+        }
+    }
+
+    std::tuple<Fields*...> pointers() const noexcept
+    {
+        return std::apply([](const auto&... list) {
+            return std::tuple<Fields*...>(const_cast<Fields*>(list.data())...);
+        }, m_columns);
+    }
+
+    std::tuple<column_type<Fields>...> m_columns;
+};
+
+/// ----------------------------------------------------------------------
+/// @class    Iterator
+/// @note Random-access iterator over the rows. Dereferencing yields a
+/// tuple of references to the fields of the row, so it models a C++20
+/// random-access iterator but only a legacy input iterator.
+/// ----------------------------------------------------------------------
+
+template <class GrowthPolicy, std::size_t Alignment, class... Fields>
+template <bool Const>
+class BasicSoAArrayList<GrowthPolicy, Alignment, Fields...>::Iterator {
+public:
+    typedef std::random_access_iterator_tag iterator_concept;
+    typedef std::input_iterator_tag         iterator_category;
+    typedef std::tuple<Fields...>           value_type;
+    typedef std::ptrdiff_t                  difference_type;
+    typedef std::conditional_t<Const, std::tuple<const Fields&...>, std::tuple<Fields&...>> reference;
+
+    Iterator() noexcept = default;
+
+    Iterator(std::tuple<Fields*...> columns, size_type index) noexcept
+    : m_columns(columns), m_index(static_cast<difference_type>(index)) {}
+
+    operator Iterator<true>() const noexcept
+    {
+        return Iterator<true>(m_columns, static_cast<size_type>(m_index));
+    }
+
+    reference operator*() const noexcept
+    {
+        return std::apply([this](auto*... column) { return reference(column[m_index]...); }, m_columns);
+    }
+
+    reference operator[](difference_type offset) const noexcept { return *(*this + offset); }
+
+    Iterator& operator++() noexcept { ++m_index; return *this; }
+    Iterator operator++(int) noexcept { Iterator old = *this; ++m_index; return old; }
+    Iterator& operator--() noexcept { --m_index; return *this; }
+    Iterator operator--(int) noexcept { Iterator old = *this; --m_index; return old; }
+
+    Iterator& operator+=(difference_type offset) noexcept { m_index += offset; return *this; }
+    Iterator& operator-=(difference_type offset) noexcept { m_index -= offset; return *this; }
+
+    friend Iterator operator+(Iterator it, difference_type offset) noexcept { return it += offset; }
+    friend Iterator operator+(difference_type offset, Iterator it) noexcept { return it += offset; }
+    friend Iterator operator-(Iterator it, difference_type offset) noexcept { return it -= offset; }
+
+    friend difference_type operator-(const Iterator& lhs, const Iterator& rhs) noexcept
+    {
+        return lhs.m_index - rhs.m_index;
+    }
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept { return lhs.m_index == rhs.m_index; }
+    friend auto operator<=>(const Iterator& lhs, const Iterator& rhs) noexcept { return lhs.m_index <=> rhs.m_index; }
+
+private:
+    std::tuple<Fields*...> m_columns{};
+    difference_type        m_index = 0;
+};
+
+/// ----------------------------------------------------------------------
+/// @typedef  SoAArrayList
+/// @note Structure-of-arrays list with doubling growth and 64-byte aligned
+/// columns.
+/// ----------------------------------------------------------------------
+
+template <class... Fields>
+using SoAArrayList = BasicSoAArrayList<DoublingGrowth, 64, Fields...>;
+
+} // namespace AL
+
+#endif /* SoAArrayList_hpp */
@@ -0,0 +1,395 @@
+/// @author - Brandon Wallace
+/// @file - SortedArrayList.hpp
+/// @brief - The SortedArrayList keeps the unique elements of an ArrayList
+/// in Compare order, a flat set: lookups are binary searches over
+/// contiguous storage instead of walks through tree nodes.
+
+#ifndef SortedArrayList_hpp
+#define SortedArrayList_hpp
+
+/// C++ Standard Library Header Files
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/// User Defined Header Files
+#include "ArrayList.hpp"
+
+namespace AL {
+
+namespace detail {
+
+/// ----------------------------------------------------------------------
+/// @function branchless_lower_bound
+/// @param    first    holds the beginning of the sorted range
+/// @param    count    holds the number of elements in the range
+/// @param    key      holds the key to search for
+/// @param    comp     holds the ordering of the range
+/// @return   Returns the first position whose element isn't less than key.
+/// @note Each step halves the range with a conditional move instead of a
+/// branch, so the loop runs log2(count) times whatever the key and never
+/// mispredicts.
+/// ----------------------------------------------------------------------
+
+template <std::random_access_iterator It, class Key, class Compare>
+It branchless_lower_bound(It first, std::size_t count, const Key& key, Compare& comp)
+{
+    if (count == 0)
+    {
+        return first;
+    }
+
+    while (count > 1)
+    {
+        const std::size_t half = count / 2;
+        first  = comp(first[static_cast<std::ptrdiff_t>(half)], key) ? first + static_cast<std::ptrdiff_t>(half) : first;
+        count -= half;
+    }
+    return first + static_cast<std::ptrdiff_t>(comp(*first, key));
+}
+
+/// Compare::is_transparent enables lookups by keys other than T.
+template <class Compare>
+concept transparent_compare = requires { typename Compare::is_transparent; };
+
+} // namespace detail
+
+/// ----------------------------------------------------------------------
+/// @class    SortedArrayList
+/// @note Set of unique elements, ordered by Compare, stored in a List
+/// (ArrayList<T> by default). find, lower_bound, contains and the
+/// single-element insert and erase locate their position with a branchless
+/// binary search; insert and erase then shift the tail, like
+/// List::insert. insert_range appends all the new elements, sorts them and
+/// merges them in once, instead of shifting the tail once per element.
+///
+/// Iterators are const: changing an element in place could break the
+/// order. Inserting or erasing invalidates them, as for List.
+/// ----------------------------------------------------------------------
+
+template <class T, class Compare = std::less<T>, class List = ArrayList<T>>
+class SortedArrayList {
+public:
+    typedef T                                 key_type;
+    typedef T                                 value_type;
+    typedef Compare                           key_compare;
+    typedef List                              list_type;
+    typedef typename List::size_type          size_type;
+    typedef typename List::difference_type    difference_type;
+    typedef typename List::const_reference    const_reference;
+    typedef typename List::const_iterator     const_iterator;
+    typedef const_iterator                    iterator;
+
+    /// ----------------------------------------------------------------------
+    /// @function SortedArrayList  </Default Constructor/>
+    /// @param    comp     holds the ordering of the elements
+    /// ----------------------------------------------------------------------
+
+    SortedArrayList() = default;
+    explicit SortedArrayList(const Compare& comp) : m_comp(comp) {}
+
+    /// ----------------------------------------------------------------------
+    /// @function SortedArrayList
+    /// @param    init_list   holds the elements to insert
+    /// @param    comp        holds the ordering of the elements
+    /// ----------------------------------------------------------------------
+
+    SortedArrayList(std::initializer_list<value_type> init_list, const Compare& comp = Compare())
+        : m_comp(comp)
+    {
+        insert_range(init_list);
+    }
+
+    /// ----------------------------------------------------------------------
+    /// @function SortedArrayList
+    /// @param    range    holds the elements to insert
+    /// @param    comp     holds the ordering of the elements
+    /// @note Duplicates keep the first of the equivalent elements.
+    /// ----------------------------------------------------------------------
+
+    template <std::ranges::input_range R>
+    SortedArrayList(from_range_t, R&& range, const Compare& comp = Compare())
+        : m_comp(comp)
+    {
+        insert_range(std::forward<R>(range));
+    }
+
+    //! *** Element Access *** !//
+
+    const_reference at(size_type index) const { return m_list.at(index); }
+    const_reference front() const { return m_list.front(); }
+    const_reference back() const { return m_list.back(); }
+    const value_type* data() const noexcept { return m_list.data(); }
+
+    const_iterator begin() const noexcept  { return m_list.begin(); }
+    const_iterator cbegin() const noexcept { return m_list.cbegin(); }
+    const_iterator end() const noexcept    { return m_list.end(); }
+    const_iterator cend() const noexcept   { return m_list.cend(); }
+
+    /// ----------------------------------------------------------------------
+    /// @function list
+    /// @return   Returns the sorted list of elements.
+    /// ----------------------------------------------------------------------
+
+    const list_type& list() const& noexcept { return m_list; }
+    list_type list() && noexcept { return std::move(m_list); }
+
+    key_compare key_comp() const { return m_comp; }
+
+    //! *** Capacity *** !//
+
+    bool      empty() const noexcept    { return m_list.empty(); }
+    size_type size() const noexcept     { return m_list.size(); }
+    size_type capacity() const noexcept { return m_list.capacity(); }
+
+    void reserve(size_type new_capacity) { m_list.reserve(new_capacity); }
+    void shrink_to_fit() { m_list.shrink_to_fit(); }
+
+    //! *** Lookup *** !//
+
+    /// ----------------------------------------------------------------------
+    /// @function lower_bound
+    /// @param    key      holds the key to search for
+    /// @return   Returns the first element not ordered before key.
+    /// @note Lookups take keys of other types when Compare is transparent,
+    /// e.g. std::less<>, for all of lower_bound, upper_bound, find,
+    /// contains, count and erase.
+    /// ----------------------------------------------------------------------
+
+    const_iterator lower_bound(const key_type& key) const { return lower_bound_of(key); }
+
+    template <class Key>
+    requires detail::transparent_compare<Compare>
+    const_iterator lower_bound(const Key& key) const { return lower_bound_of(key); }
+
+    /// ----------------------------------------------------------------------
+    /// @function upper_bound
+    /// @param    key      holds the key to search for
+    /// @return   Returns the first element ordered after key.
+    /// ----------------------------------------------------------------------
+
+    const_iterator upper_bound(const key_type& key) const { return upper_bound_of(key); }
+
+    template <class Key>
+    requires detail::transparent_compare<Compare>
+    const_iterator upper_bound(const Key& key) const { return upper_bound_of(key); }
+
+    /// ----------------------------------------------------------------------
+    /// @function find
+    /// @param    key      holds the key to search for
+    /// @return   Returns the element equivalent to key, or end() if there
+    ///           is none.
+    /// ----------------------------------------------------------------------
+
+    const_iterator find(const key_type& key) const { return find_of(key); }
+
+    template <class Key>
+    requires detail::transparent_compare<Compare>
+    const_iterator find(const Key& key) const { return find_of(key); }
+
+    bool contains(const key_type& key) const { return find_of(key) != cend(); }
+
+    template <class Key>
+    requires detail::transparent_compare<Compare>
+    bool contains(const Key& key) const { return find_of(key) != cend(); }
+
+    size_type count(const key_type& key) const { return contains(key) ? 1 : 0; }
+
+    template <class Key>
+    requires detail::transparent_compare<Compare>
+    size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+    //! *** Modifiers *** !//
+
+    /// ----------------------------------------------------------------------
+    /// @function insert
+    /// @param    value    holds the element to insert
+    /// @return   Returns the element equivalent to value and whether it was
+    ///           inserted, i.e. wasn't there already.
+    /// ----------------------------------------------------------------------
+
+    std::pair<const_iterator, bool> insert(const value_type& value) { return emplace(value); }
+    std::pair<const_iterator, bool> insert(value_type&& value) { return emplace(std::move(value)); }
+
+    /// ----------------------------------------------------------------------
+    /// @function emplace
+    /// @param    args     holds the arguments to construct the element with
+    /// @return   Returns the element equivalent to the new one and whether
+    ///           it was inserted.
+    /// ----------------------------------------------------------------------
+
+    template <class... Args>
+    std::pair<const_iterator, bool> emplace(Args&&... args);
+
+    /// ----------------------------------------------------------------------
+    /// @function insert_range
+    /// @param    range    holds the elements to insert
+    /// @note Appends the elements, sorts them and merges them with the old
+    /// ones in a single pass, O(n + k log k) for k new elements. Existing
+    /// elements win over equivalent new ones; among new duplicates the
+    /// first one wins.
+    /// ----------------------------------------------------------------------
+
+    template <std::ranges::input_range R>
+    void insert_range(R&& range);
+
+    void insert(std::initializer_list<value_type> init_list) { insert_range(init_list); }
+
+    /// ----------------------------------------------------------------------
+    /// @function erase
+    /// @param    key      holds the key of the element to remove
+    /// @return   Returns the number of elements removed, 0 or 1.
+    /// ----------------------------------------------------------------------
+
+    size_type erase(const key_type& key) { return erase_of(key); }
+
+    template <class Key>
+    requires (detail::transparent_compare<Compare> && !std::is_convertible_v<const Key&, const_iterator>)
+    size_type erase(const Key& key) { return erase_of(key); }
+
+    /// ----------------------------------------------------------------------
+    /// @function erase
+    /// @param    pos      holds the position of the element to remove
+    /// @return   Returns an iterator following the removed element.
+    /// ----------------------------------------------------------------------
+
+    const_iterator erase(const_iterator pos) { return m_list.erase(pos); }
+    const_iterator erase(const_iterator first, const_iterator last) { return m_list.erase(first, last); }
+
+    void clear() noexcept { m_list.clear(); }
+
+    void swap(SortedArrayList& other) noexcept
+    {
+        using std::swap;
+        swap(m_list, other.m_list);
+        swap(m_comp, other.m_comp);
+    }
+
+    //! *** Operators *** !//
+
+    const_reference operator[](size_type index) const { return m_list[index]; }
+
+    friend bool operator==(const SortedArrayList& lhs, const SortedArrayList& rhs)
+    {
+        return lhs.m_list == rhs.m_list;
+    }
+
+    friend std::ostream& operator<<(std::ostream& output, const SortedArrayList& set)
+    {
+        return output << set.m_list;
+    }
+
+private:
+    template <class Key>
+    const_iterator lower_bound_of(const Key& key) const
+    {
+        return detail::branchless_lower_bound(cbegin(), size(), key, m_comp);
+    }
+
+    template <class Key>
+    const_iterator upper_bound_of(const Key& key) const
+    {
+        const_iterator it = lower_bound_of(key);
+        return it != cend() && !m_comp(key, *it) ? it + 1 : it;
+    }
+
+    template <class Key>
+    const_iterator find_of(const Key& key) const
+    {
+        const_iterator it = lower_bound_of(key);
+        return it != cend() && !m_comp(key, *it) ? it : cend();
+    }
+
+    template <class Key>
+    size_type erase_of(const Key& key)
+    {
+        const_iterator it = find_of(key);
+        if (it == cend())
+        {
+            return 0;
+        }
+        m_list.erase(it);
+        return 1;
+    }
+
+    bool equivalent(const value_type& lhs, const value_type& rhs) const
+    {
+        return !m_comp(lhs, rhs) && !m_comp(rhs, lhs);
+    }
+
+    list_type                         m_list;
+    [[no_unique_address]] key_compare m_comp;
+};
+
+//! ******************* D E F I N I T I O N S ************************ !//
+
+/// ----------------------------------------------------------------------
+/// @function emplace
+/// @param    args     holds the arguments to construct the element with
+/// @return   Returns the element equivalent to the new one and whether
+///           it was inserted.
+/// ----------------------------------------------------------------------
+
+template <class T, class Compare, class List>
+template <class... Args>
+std::pair<typename SortedArrayList<T, Compare, List>::const_iterator, bool>
+SortedArrayList<T, Compare, List>::emplace(Args&&... args)
+{
+    value_type value(std::forward<Args>(args)...);
+
+    const_iterator it = lower_bound_of(value);
+    if (it != cend() && !m_comp(value, *it))
+    {
+        return { it, false };
+    }
+    return { m_list.insert(it, std::move(value)), true };
+}
+
+/// ----------------------------------------------------------------------
+/// @function insert_range
+/// @param    range    holds the elements to insert
+/// @note Appends the elements, sorts them and merges them with the old
+/// ones in a single pass, O(n + k log k) for k new elements. Existing
+/// elements win over equivalent new ones; among new duplicates the
+/// first one wins.
+/// ----------------------------------------------------------------------
+
+template <class T, class Compare, class List>
+template <std::ranges::input_range R>
+void SortedArrayList<T, Compare, List>::insert_range(R&& range)
+{
+    const size_type old_size = m_list.size();
+    m_list.append_range(std::forward<R>(range));
+
+    auto first  = m_list.begin();
+    auto middle = first + static_cast<difference_type>(old_size);
+    auto last   = m_list.end();
+
+    if (middle == last)
+    {
+        return;
+    }
+
+    // stable sort and merge keep the earliest of equivalent elements first
+    std::stable_sort(middle, last, m_comp);
+    if (first != middle && m_comp(*middle, *(middle - 1)))
+    {
+        std::inplace_merge(first, middle, last, m_comp);
+    }
+
+    auto unique_end = std::unique(first, last, [this](const value_type& lhs, const value_type& rhs) {
+        return equivalent(lhs, rhs);
+    });
+    m_list.erase(unique_end, m_list.end());
+}
+
+} // namespace AL
+
+#endif /* SortedArrayList_hpp */
@@ -0,0 +1,541 @@
+/// @author - Brandon Wallace
+/// @file - SpscArrayQueue.hpp
+/// @brief - The SpscArrayQueue hands elements from one producer thread to
+/// one consumer thread without locks, through a fixed ring of slots kept
+/// in an ArrayList.
+
+#ifndef SpscArrayQueue_hpp
+#define SpscArrayQueue_hpp
+
+/// C++ Standard Library Header Files
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/// User Defined Header Files
+#include "ArrayList.hpp"
+
+namespace AL {
+
+/// ----------------------------------------------------------------------
+/// @class    SpscArrayQueue
+/// @note Bounded FIFO for exactly one producer and one consumer thread.
+/// The capacity is rounded up to a power of two so a position maps to its
+/// slot with a mask. Each side owns a cache line holding its index and a
+/// cached copy of the other side's, and only reloads the other index when
+/// the cached one says the queue is full, or empty.
+///
+/// The try_ functions never block. try_push_range and try_pop_range move
+/// as many elements as fit in one go, as at most two contiguous runs,
+/// with memcpy for trivially copyable T, and publish them with a single
+/// store. push, push_range, pop and pop_range block with
+/// std::atomic::wait until there is room or data; a side only calls
+/// notify when the other is waiting, at the price of a seq_cst store per
+/// publish.
+///
+/// Producer functions: try_push, try_emplace, try_push_range, push,
+/// push_range. Consumer functions: try_pop, try_pop_range, pop, pop_range.
+/// ----------------------------------------------------------------------
+
+template <class T>
+class SpscArrayQueue {
+    struct alignas(T) Slot {
+        std::byte bytes[sizeof(T)];
+    };
+
+public:
+    typedef T           value_type;
+    typedef std::size_t size_type;
+
+    static constexpr std::size_t cache_line_size = 64;
+
+    /// ----------------------------------------------------------------------
+    /// @function SpscArrayQueue
+    /// @param    capacity    holds the minimum number of elements the
+    ///                       queue can hold, rounded up to a power of two
+    /// ----------------------------------------------------------------------
+
+    explicit SpscArrayQueue(size_type capacity);
+
+    SpscArrayQueue(const SpscArrayQueue&) = delete;
+    SpscArrayQueue& operator=(const SpscArrayQueue&) = delete;
+
+    /// ----------------------------------------------------------------------
+    /// @function ~SpscArrayQueue  </Destructor/>
+    /// @note Destroys the elements still queued; neither side may be
+    /// running.
+    /// ----------------------------------------------------------------------
+
+    ~SpscArrayQueue();
+
+    //! *** Capacity *** !//
+
+    size_type capacity() const noexcept { return m_mask + 1; }
+
+    /// ----------------------------------------------------------------------
+    /// @function size
+    /// @return   Returns the number of queued elements, already stale while
+    ///           the other side is running.
+    /// ----------------------------------------------------------------------
+
+    size_type size() const noexcept
+    {
+        const size_type head = m_consumer.head.load(std::memory_order_acquire);
+        return m_producer.tail.load(std::memory_order_acquire) - head;
+    }
+
+    bool empty() const noexcept { return size() == 0; }
+
+    //! *** Producer *** !//
+
+    /// ----------------------------------------------------------------------
+    /// @function try_emplace
+    /// @param    args     holds the arguments to construct the element with
+    /// @return   Returns 'True' if the element was queued, 'False' if the
+    ///           queue was full.
+    /// ----------------------------------------------------------------------
+
+    template <class... Args>
+    bool try_emplace(Args&&... args);
+
+    bool try_push(const value_type& value) { return try_emplace(value); }
+    bool try_push(value_type&& value) { return try_emplace(std::move(value)); }
+
+    /// ----------------------------------------------------------------------
+    /// @function try_push_range
+    /// @param    range    holds the elements to queue, copied or, through
+    ///                    move iterators, moved
+    /// @return   Returns how many of the leading elements were queued.
+    /// ----------------------------------------------------------------------
+
+    template <std::ranges::sized_range R>
+    size_type try_push_range(R&& range);
+
+    /// ----------------------------------------------------------------------
+    /// @function push, push_range
+    /// @note Block until every element is queued.
+    /// ----------------------------------------------------------------------
+
+    void push(const value_type& value) { emplace(value); }
+    void push(value_type&& value) { emplace(std::move(value)); }
+
+    template <class... Args>
+    void emplace(Args&&... args)
+    {
+        value_type value(std::forward<Args>(args)...);
+        while (!try_emplace(std::move(value)))
+        {
+            wait_for_space();
+        }
+    }
+
+    template <std::ranges::sized_range R>
+    void push_range(R&& range);
+
+    //! *** Consumer *** !//
+
+    /// ----------------------------------------------------------------------
+    /// @function try_pop
+    /// @param    out      holds where to move the front element
+    /// @return   Returns 'True' if an element was popped, 'False' if the
+    ///           queue was empty.
+    /// ----------------------------------------------------------------------
+
+    bool try_pop(value_type& out);
+
+    /// ----------------------------------------------------------------------
+    /// @function try_pop_range
+    /// @param    out      holds the elements to move the popped ones into
+    /// @return   Returns how many elements were popped into the front of
+    ///           out, at most out.size().
+    /// ----------------------------------------------------------------------
+
+    size_type try_pop_range(std::span<value_type> out);
+
+    /// ----------------------------------------------------------------------
+    /// @function pop
+    /// @return   Returns the front element, blocking until there is one.
+    /// ----------------------------------------------------------------------
+
+    value_type pop();
+
+    /// ----------------------------------------------------------------------
+    /// @function pop_range
+    /// @param    out      holds the elements to move the popped ones into
+    /// @return   Returns how many elements were popped, blocking until at
+    ///           least one is available when out isn't empty.
+    /// ----------------------------------------------------------------------
+
+    size_type pop_range(std::span<value_type> out)
+    {
+        size_type count = try_pop_range(out);
+        while (count == 0 && !out.empty())
+        {
+            wait_for_data();
+            count = try_pop_range(out);
+        }
+        return count;
+    }
+
+private:
+    value_type* slot(size_type position) noexcept
+    {
+        return std::launder(reinterpret_cast<value_type*>(m_slots[position & m_mask].bytes));
+    }
+
+    /// Free slots as seen by the producer, reloading head only when short.
+    size_type free_slots(size_type tail, size_type wanted) noexcept
+    {
+        size_type free = capacity() - (tail - m_producer.cached_head);
+        if (free < wanted)
+        {
+            m_producer.cached_head = m_consumer.head.load(std::memory_order_acquire);
+            free = capacity() - (tail - m_producer.cached_head);
+        }
+        return free;
+    }
+
+    /// Queued elements as seen by the consumer, reloading tail only when short.
+    size_type queued(size_type head, size_type wanted) noexcept
+    {
+        size_type count = m_consumer.cached_tail - head;
+        if (count < wanted)
+        {
+            m_consumer.cached_tail = m_producer.tail.load(std::memory_order_acquire);
+            count = m_consumer.cached_tail - head;
+        }
+        return count;
+    }
+
+    void publish_tail(size_type tail) noexcept
+    {
+        // seq_cst on both sides of the flag and the index, so either the
+        // waiter sees the new index or this side sees the waiter
+        m_producer.tail.store(tail, std::memory_order_seq_cst);
+        if (m_waiting.consumer.load(std::memory_order_seq_cst))
+        {
+            m_producer.tail.notify_one();
+        }
+    }
+
+    void publish_head(size_type head) noexcept
+    {
+        m_consumer.head.store(head, std::memory_order_seq_cst);
+        if (m_waiting.producer.load(std::memory_order_seq_cst))
+        {
+            m_consumer.head.notify_one();
+        }
+    }
+
+    void wait_for_space() noexcept;
+    void wait_for_data() noexcept;
+
+    struct alignas(cache_line_size) ProducerSide {
+        std::atomic<size_type> tail{ 0 };
+        size_type              cached_head = 0;
+    };
+
+    struct alignas(cache_line_size) ConsumerSide {
+        std::atomic<size_type> head{ 0 };
+        size_type              cached_tail = 0;
+    };
+
+    struct alignas(cache_line_size) WaitFlags {
+        std::atomic<bool> producer{ false };
+        std::atomic<bool> consumer{ false };
+    };
+
+    ProducerSide m_producer;
+    ConsumerSide m_consumer;
+    WaitFlags    m_waiting;
+    size_type    m_mask = 0;
+    BasicArrayList<Slot, DoublingGrowth, AlignedAllocator<Slot, cache_line_size>> m_slots;
+};
+
+//! ******************* D E F I N I T I O N S ************************ !//
+
+/// ----------------------------------------------------------------------
+/// @function SpscArrayQueue
+/// @param    capacity    holds the minimum number of elements the
+///                       queue can hold, rounded up to a power of two
+/// ----------------------------------------------------------------------
+
+template <class T>
+SpscArrayQueue<T>::SpscArrayQueue(size_type capacity)
+{
+    if (capacity > (std::numeric_limits<size_type>::max() >> 1) + 1)
+    {
+        throw std::length_error{ "SpscArrayQueue capacity is too large!" };
+    }
+
+    const size_type slots = std::bit_ceil(std::max<size_type>(capacity, 1));
+    m_slots.resize(slots);
+    m_mask = slots - 1;
+}
+
+/// ----------------------------------------------------------------------
+/// @function ~SpscArrayQueue  </Destructor/>
+/// @note Destroys the elements still queued; neither side may be
+/// running.
+/// ----------------------------------------------------------------------
+
+template <class T>
+SpscArrayQueue<T>::~SpscArrayQueue()
+{
+    const size_type tail = m_producer.tail.load(std::memory_order_relaxed);
+    for (size_type head = m_consumer.head.load(std::memory_order_relaxed); head != tail; ++head)
+    {
+        std::destroy_at(slot(head));
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function try_emplace
+/// @param    args     holds the arguments to construct the element with
+/// @return   Returns 'True' if the element was queued, 'False' if the
+///           queue was full.
+/// ----------------------------------------------------------------------
+
+template <class T>
+template <class... Args>
+bool SpscArrayQueue<T>::try_emplace(Args&&... args)
+{
+    const size_type tail = m_producer.tail.load(std::memory_order_relaxed);
+    if (free_slots(tail, 1) == 0)
+    {
+        return false;
+    }
+
+    std::construct_at(slot(tail), std::forward<Args>(args)...);
+    publish_tail(tail + 1);
+    return true;
+}
+
+/// ----------------------------------------------------------------------
+/// @function try_push_range
+/// @param    range    holds the elements to queue, copied or, through
+///                    move iterators, moved
+/// @return   Returns how many of the leading elements were queued.
+/// ----------------------------------------------------------------------
+
+template <class T>
+template <std::ranges::sized_range R>
+typename SpscArrayQueue<T>::size_type SpscArrayQueue<T>::try_push_range(R&& range)
+{
+    const size_type tail   = m_producer.tail.load(std::memory_order_relaxed);
+    const size_type wanted = static_cast<size_type>(std::ranges::size(range));
+    const size_type count  = std::min(wanted, free_slots(tail, wanted));
+
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    auto it = std::ranges::begin(range);
+
+    if constexpr (std::ranges::contiguous_range<R> && std::is_trivially_copyable_v<T> &&
+                  std::is_same_v<std::remove_cv_t<std::ranges::range_value_t<R>>, T>)
+    {
+        // at most two runs, up to the end of the slots and from their start
+        const size_type first = std::min(count, capacity() - (tail & m_mask));
+        const auto*     data  = std::to_address(it);
+        std::memcpy(static_cast<void*>(slot(tail)), data, first * sizeof(T));
+        std::memcpy(static_cast<void*>(slot(0)), data + first, (count - first) * sizeof(T));
+    }
+    else
+    {
+        size_type constructed = 0;
+        try
+        {
+            for (; constructed != count; ++constructed, ++it)
+            {
+                std::construct_at(slot(tail + constructed), *it);
+            }
+        }
+        catch (...)
+        {
+            // nothing was published, drop what this call constructed
+            for (size_type index = 0; index != constructed; ++index)
+            {
+                std::destroy_at(slot(tail + index));
+            }
+            throw;
+        }
+    }
+
+    publish_tail(tail + count);
+    return count;
+}
+
+/// ----------------------------------------------------------------------
+/// @function push_range
+/// @param    range    holds the elements to queue
+/// @note Blocks until every element is queued.
+/// ----------------------------------------------------------------------
+
+template <class T>
+template <std::ranges::sized_range R>
+void SpscArrayQueue<T>::push_range(R&& range)
+{
+    auto      it        = std::ranges::begin(range);
+    size_type remaining = static_cast<size_type>(std::ranges::size(range));
+
+    while (remaining != 0)
+    {
+        const size_type count = try_push_range(
+            std::ranges::subrange(it, std::ranges::end(range), static_cast<std::make_unsigned_t<
+                std::ranges::range_difference_t<R>>>(remaining)));
+
+        if (count == 0)
+        {
+            wait_for_space();
+            continue;
+        }
+        std::ranges::advance(it, static_cast<std::ranges::range_difference_t<R>>(count));
+        remaining -= count;
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function try_pop
+/// @param    out      holds where to move the front element
+/// @return   Returns 'True' if an element was popped, 'False' if the
+///           queue was empty.
+/// ----------------------------------------------------------------------
+
+template <class T>
+bool SpscArrayQueue<T>::try_pop(value_type& out)
+{
+    return try_pop_range(std::span<value_type>(&out, 1)) == 1;
+}
+
+/// ----------------------------------------------------------------------
+/// @function try_pop_range
+/// @param    out      holds the elements to move the popped ones into
+/// @return   Returns how many elements were popped into the front of
+///           out, at most out.size().
+/// ----------------------------------------------------------------------
+
+template <class T>
+typename SpscArrayQueue<T>::size_type SpscArrayQueue<T>::try_pop_range(std::span<value_type> out)
+{
+    const size_type head  = m_consumer.head.load(std::memory_order_relaxed);
+    const size_type count = std::min(out.size(), queued(head, out.size()));
+
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    if constexpr (std::is_trivially_copyable_v<T>)
+    {
+        const size_type first = std::min(count, capacity() - (head & m_mask));
+        std::memcpy(static_cast<void*>(out.data()), slot(head), first * sizeof(T));
+        std::memcpy(static_cast<void*>(out.data() + first), slot(0), (count - first) * sizeof(T));
+    }
+    else
+    {
+        size_type popped = 0;
+        try
+        {
+            for (; popped != count; ++popped)
+            {
+                value_type* item = slot(head + popped);
+                out[popped] = std::move(*item);
+                std::destroy_at(item);
+            }
+        }
+        catch (...)
+        {
+            // hand over the elements already moved out
+            publish_head(head + popped);
+            throw;
+        }
+    }
+
+    publish_head(head + count);
+    return count;
+}
+
+/// ----------------------------------------------------------------------
+/// @function pop
+/// @return   Returns the front element, blocking until there is one.
+/// ----------------------------------------------------------------------
+
+template <class T>
+typename SpscArrayQueue<T>::value_type SpscArrayQueue<T>::pop()
+{
+    const size_type head = m_consumer.head.load(std::memory_order_relaxed);
+    while (queued(head, 1) == 0)
+    {
+        wait_for_data();
+    }
+
+    value_type* item  = slot(head);
+    value_type  value = std::move(*item);
+    std::destroy_at(item);
+    publish_head(head + 1);
+
+    return value;
+}
+
+/// ----------------------------------------------------------------------
+/// @function wait_for_space
+/// @note Producer side: sleeps until the queue has a free slot.
+/// ----------------------------------------------------------------------
+
+template <class T>
+void SpscArrayQueue<T>::wait_for_space() noexcept
+{
+    const size_type tail = m_producer.tail.load(std::memory_order_relaxed);
+
+    m_waiting.producer.store(true, std::memory_order_seq_cst);
+
+    size_type head = m_consumer.head.load(std::memory_order_seq_cst);
+    while (tail - head == capacity())
+    {
+        m_consumer.head.wait(head, std::memory_order_acquire);
+        head = m_consumer.head.load(std::memory_order_acquire);
+    }
+
+    m_waiting.producer.store(false, std::memory_order_relaxed);
+    m_producer.cached_head = head;
+}
+
+/// ----------------------------------------------------------------------
+/// @function wait_for_data
+/// @note Consumer side: sleeps until the queue holds an element.
+/// ----------------------------------------------------------------------
+
+template <class T>
+void SpscArrayQueue<T>::wait_for_data() noexcept
+{
+    const size_type head = m_consumer.head.load(std::memory_order_relaxed);
+
+    m_waiting.consumer.store(true, std::memory_order_seq_cst);
+
+    size_type tail = m_producer.tail.load(std::memory_order_seq_cst);
+    while (tail == head)
+    {
+        m_producer.tail.wait(tail, std::memory_order_acquire);
+        tail = m_producer.tail.load(std::memory_order_acquire);
+    }
+
+    m_waiting.consumer.store(false, std::memory_order_relaxed);
+    m_consumer.cached_tail = tail;
+}
+
+} // namespace AL
+
+#endif /* SpscArrayQueue_hpp */
@@ -0,0 +1,1044 @@
+/// @author - Brandon Wallace
+/// @file - StaticArrayList.hpp
+/// @brief - The StaticArrayList is a fixed-capacity container with the
+/// ArrayList interface. Its elements are stored inside the object itself,
+/// so it never allocates.
+
+#ifndef StaticArrayList_hpp
+#define StaticArrayList_hpp
+
+/// C++ Standard Library Header Files
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace AL {
+
+//! *********************** Overflow Policies ************************ !//
+
+/// ----------------------------------------------------------------------
+/// @struct   ThrowOnOverflow
+/// @note OverflowPolicy that throws std::length_error when an element
+/// doesn't fit. An OverflowPolicy provides
+///
+///     static void overflow(const char* what);
+///
+/// which is called instead of growing past the capacity and must not return.
+/// ----------------------------------------------------------------------
+
+struct ThrowOnOverflow {
+    [[noreturn]] static void overflow(const char* what)
+    {
+        throw std::length_error{ what };
+    }
+};
+
+/// ----------------------------------------------------------------------
+/// @struct   AssertOnOverflow
+/// @note OverflowPolicy that fails an assertion when an element doesn't
+/// fit, and aborts even when NDEBUG disables assertions.
+/// ----------------------------------------------------------------------
+
+struct AssertOnOverflow {
+    [[noreturn]] static void overflow(const char* /* what */)
+    {
+        assert(!"Capacity of the StaticArrayList exceeded!");
+        std::abort();
+    }
+};
+
+namespace detail {
+
+/// ----------------------------------------------------------------------
+/// @struct   StaticStorage
+/// @note Room for N elements inside the container. Trivial types are kept
+/// in a plain array, which constant evaluation can use directly; other
+/// types live in a union and are constructed one by one.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N,
+          bool = std::is_trivially_default_constructible_v<T> &&
+                 std::is_trivially_destructible_v<T>>
+struct StaticStorage {
+    constexpr StaticStorage() noexcept
+    {
+        // constant evaluation doesn't allow indeterminate elements
+        if (std::is_constant_evaluated())
+        {
+            std::fill_n(m_elements, N, T());
+        }
+    }
+
+    constexpr T*       data() noexcept       { return m_elements; }
+    constexpr const T* data() const noexcept { return m_elements; }
+
+    T m_elements[N];  ///< Element storage.
+};
+
+template <class T, std::size_t N>
+struct StaticStorage<T, N, false> {
+    constexpr StaticStorage() noexcept {}
+
+    StaticStorage(const StaticStorage&)            = delete;
+    StaticStorage& operator=(const StaticStorage&) = delete;
+
+    ~StaticStorage() requires std::is_trivially_destructible_v<T> = default;
+    constexpr ~StaticStorage() {}
+
+    constexpr T*       data() noexcept       { return m_elements; }
+    constexpr const T* data() const noexcept { return m_elements; }
+
+    union {
+        T m_elements[N];  ///< Element storage, constructed up to the size.
+    };
+};
+
+} // namespace detail
+
+template <class T, std::size_t N, class OverflowPolicy = ThrowOnOverflow>
+class StaticArrayList {
+public:
+    // type aliases
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using pointer         = value_type*;
+    using const_pointer   = const value_type*;
+    using iterator        = pointer;
+    using const_iterator  = const_pointer;
+
+    static_assert(N > 0, "StaticArrayList needs room for at least one element");
+
+    /// ----------------------------------------------------------------------
+    /// @function StaticArrayList </! Default Constructor !/>
+    ///
+    /// @note Default constructor. Constructs an empty StaticArrayList.
+    /// ----------------------------------------------------------------------
+
+    constexpr StaticArrayList() noexcept = default;
+
+    /// ----------------------------------------------------------------------
+    /// @function StaticArrayList
+    /// @param count    holds the number of elements to construct
+    /// @note Constructs a StaticArrayList with count copies of the default
+    /// value of value_type. A count greater than N is an overflow.
+    /// ----------------------------------------------------------------------
+
+    constexpr StaticArrayList(size_type count);
+
+    /// ----------------------------------------------------------------------
+    /// @function StaticArrayList
+    /// @param    source   Holds initializer list of elements
+    /// @note     Constructs a container with a copy of the source elements.
+    /// ----------------------------------------------------------------------
+
+    constexpr StaticArrayList(std::initializer_list<value_type> source);
+
+    /// ----------------------------------------------------------------------
+    /// @function StaticArrayList  </! Copy Constructor !/>
+    /// @param    other    holds a reference to other StaticArrayList
+    /// @note     Copies other's elements.
+    /// ----------------------------------------------------------------------
+
+    constexpr StaticArrayList(const StaticArrayList& other);
+
+    /// ----------------------------------------------------------------------
+    /// @function StaticArrayList  </! Move Constructor !/>
+    /// @param    other     holds the state of another object being moved
+    /// @note Moves other's elements one by one, leaving other empty.
+    /// ----------------------------------------------------------------------
+
+    constexpr StaticArrayList(StaticArrayList&& other)
+    noexcept(std::is_nothrow_move_constructible_v<T>);
+
+    /// ----------------------------------------------------------------------
+    /// @function ~StaticArrayList  </! Deconstructor !/>
+    ///
+    /// @note Destroys the elements. Trivial for trivially destructible types.
+    /// ----------------------------------------------------------------------
+
+    ~StaticArrayList() requires std::is_trivially_destructible_v<T> = default;
+    constexpr ~StaticArrayList() { clear(); }
+
+    /// ----------------------------------------------------------------------
+    /// @function at
+    /// @param    pos     Zero-based index of the element to access
+    /// @return   Returns a reference to an element at the specified position.
+    /// ----------------------------------------------------------------------
+
+    constexpr reference at(size_type pos);
+    constexpr const_reference at(size_type pos) const;
+
+    /// ----------------------------------------------------------------------
+    /// @function front
+    ///
+    /// @return Returns a reference to the first element in the container.
+    /// ----------------------------------------------------------------------
+
+    constexpr reference front();
+    constexpr const_reference front() const;
+
+    /// ----------------------------------------------------------------------
+    /// @function back
+    ///
+    /// @return Returns a reference to the last element in the container.
+    /// ----------------------------------------------------------------------
+
+    constexpr reference back() { return *(data() + m_size - 1); }
+    constexpr const_reference back() const { return *(data() + m_size - 1); }
+
+    /// ----------------------------------------------------------------------
+    /// @function data
+    ///
+    /// @return Returns a pointer to the first element of the storage.
+    /// ----------------------------------------------------------------------
+
+    constexpr pointer data() noexcept { return m_storage.data(); }
+    constexpr const_pointer data() const noexcept { return m_storage.data(); }
+
+    /// ----------------------------------------------------------------------
+    /// @function begin
+    ///
+    /// @return Returns an iterator to the beginning of the container.
+    /// ----------------------------------------------------------------------
+
+    constexpr iterator begin() noexcept { return data(); }
+    constexpr const_iterator begin() const noexcept { return data(); }
+
+    /// ----------------------------------------------------------------------
+    /// @function end
+    ///
+    /// @return Returns an iterator to the end of the container.
+    /// ----------------------------------------------------------------------
+
+    constexpr iterator end() noexcept { return data() + m_size; }
+    constexpr const_iterator end() const noexcept { return data() + m_size; }
+
+    /// ----------------------------------------------------------------------
+    /// @function empty
+    ///
+    /// @return Returns 'True' if the size of the container is 0, empty.
+    /// ----------------------------------------------------------------------
+
+    constexpr bool empty() const noexcept { return m_size == 0; }
+
+    /// ----------------------------------------------------------------------
+    /// @function full
+    ///
+    /// @return Returns 'True' if the container holds N elements.
+    /// ----------------------------------------------------------------------
+
+    constexpr bool full() const noexcept { return m_size == N; }
+
+    /// ----------------------------------------------------------------------
+    /// @function size
+    ///
+    /// @return Returns the number of elements in the container.
+    /// ----------------------------------------------------------------------
+
+    constexpr size_type size() const noexcept { return m_size; }
+
+    /// ----------------------------------------------------------------------
+    /// @function capacity
+    ///
+    /// @return Returns N, the maximum number of elements the container holds.
+    /// ----------------------------------------------------------------------
+
+    static constexpr size_type capacity() noexcept { return N; }
+
+    /// ----------------------------------------------------------------------
+    /// @function clear
+    ///
+    /// @note Destroys every element and resets the size of the container to 0.
+    /// ----------------------------------------------------------------------
+
+    constexpr void clear() noexcept;
+
+    /// ----------------------------------------------------------------------
+    /// @function push_back
+    ///
+    /// @param    value    holds the 'value' to append
+    /// @note Appends the given element value to the end of the container.
+    /// Appending to a full container is an overflow.
+    /// ----------------------------------------------------------------------
+
+    constexpr void push_back(const value_type& value);
+    constexpr void push_back(value_type&& value);
+
+    /// ----------------------------------------------------------------------
+    /// @function try_push_back
+    ///
+    /// @param    value    holds the 'value' to append
+    /// @return   Returns 'True' if value was appended, or 'False' without
+    ///           touching the container when it is full.
+    /// ----------------------------------------------------------------------
+
+    constexpr bool try_push_back(const value_type& value);
+    constexpr bool try_push_back(value_type&& value);
+
+    /// ----------------------------------------------------------------------
+    /// @function emplace_back
+    /// @param    args     holds the arguments forwarded to the constructor
+    /// @return   Returns a reference to the new element.
+    /// @note Constructs a new element in place at the end of the container.
+    /// Appending to a full container is an overflow.
+    /// ----------------------------------------------------------------------
+
+    template <class... Args>
+    constexpr reference emplace_back(Args&&... args);
+
+    /// ----------------------------------------------------------------------
+    /// @function try_emplace_back
+    /// @param    args     holds the arguments forwarded to the constructor
+    /// @return   Returns 'True' if the element was constructed, or 'False'
+    ///           without touching the container when it is full.
+    /// ----------------------------------------------------------------------
+
+    template <class... Args>
+    constexpr bool try_emplace_back(Args&&... args);
+
+    /// ----------------------------------------------------------------------
+    /// @function pop_back
+    ///
+    /// @note Destroys the last element of the container.
+    /// ----------------------------------------------------------------------
+
+    constexpr void pop_back();
+
+    /// ----------------------------------------------------------------------
+    /// @function insert
+    /// @param    pos        holds the position to be inserted to
+    /// @param    value    holds the new element to be inserted
+    /// @return   Returns an iterator pointing to the newly inserted element.
+    /// @note     Inserts the new element 'value', at the iterator 'pos'.
+    /// ----------------------------------------------------------------------
+
+    constexpr iterator insert(const_iterator pos, const value_type& value);
+    constexpr iterator insert(const_iterator pos, value_type&& value);
+
+    /// ----------------------------------------------------------------------
+    /// @function emplace
+    /// @param    pos      holds the position to be inserted to
+    /// @param    args     holds the arguments forwarded to the constructor
+    /// @return   Returns an iterator pointing to the new element.
+    /// @note     Constructs a new element in place, at the iterator 'pos'.
+    /// ----------------------------------------------------------------------
+
+    template <class... Args>
+    constexpr iterator emplace(const_iterator pos, Args&&... args);
+
+    /// ----------------------------------------------------------------------
+    /// @function erase
+    /// @param    pos  holds the position to be erased
+    /// @return   Returns an iterator pointing to the element immediately
+    ///           following the erased element.
+    /// @note Removes the element at the position indicated by the iterator.
+    /// ----------------------------------------------------------------------
+
+    constexpr iterator erase(const_iterator pos);
+
+    /// ----------------------------------------------------------------------
+    /// @function resize
+    /// @param    count    holds the new size of the desired container
+    /// @note Resizes the container to the specified 'count', destroying or
+    /// default-constructing elements at the end. A count greater than N is
+    /// an overflow.
+    /// ----------------------------------------------------------------------
+
+    constexpr void resize(size_type count);
+
+    /// ----------------------------------------------------------------------
+    /// @function swap
+    /// @param    other   holds a reference to other contianer
+    /// @note Exchanges the contents of the container with those of another,
+    /// element by element.
+    /// ----------------------------------------------------------------------
+
+    constexpr void swap(StaticArrayList& other);
+
+    /// ----------------------------------------------------------------------
+    /// @function operator=   </Copy Assignment Operator/>
+    /// @param     rhs          holds contents of other container
+    /// @return  Replaces the contents of the container
+    ///          with a copy of the contents of rhs
+    /// @return *this
+    /// ----------------------------------------------------------------------
+
+    constexpr StaticArrayList& operator=(const StaticArrayList& rhs);
+
+    /// ----------------------------------------------------------------------
+    /// @function operator=  </Move Assignment Operator/>
+    /// @param    other     holds contents of source container
+    /// @return   Replaces the contents of the container with other's
+    ///           elements, moved one by one, leaving other empty.
+    /// @return *this
+    /// ----------------------------------------------------------------------
+
+    constexpr StaticArrayList& operator=(StaticArrayList&& other);
+
+    /// ----------------------------------------------------------------------
+    /// @function operator+=
+    /// @param other    holds other contents to be appended
+    /// @return Appends the contents of other to the contianer. If they don't
+    ///         all fit, it is an overflow and nothing is appended.
+    /// ----------------------------------------------------------------------
+
+    constexpr StaticArrayList& operator+=(const StaticArrayList& other);
+
+    /// ----------------------------------------------------------------------
+    /// @function operator[]
+    /// @param    index  holds the position of the element you want to access
+    /// @return   Returns a reference as an array element
+    /// ----------------------------------------------------------------------
+
+    constexpr reference operator[](size_type index) { return *(data() + index); }
+    constexpr const_reference operator[](size_type index) const { return *(data() + index); }
+
+private:
+    /// True when the elements are a plain array of live trivial objects.
+    static constexpr bool trivial_storage =
+        std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>;
+
+    /// ----------------------------------------------------------------------
+    /// @function construct
+    /// @param    location    holds the slot to construct in
+    /// @param    args        holds the arguments forwarded to the constructor
+    /// @note Constructs an element in an unused slot. During constant
+    /// evaluation the live trivial slot is assigned instead.
+    /// ----------------------------------------------------------------------
+
+    template <class... Args>
+    constexpr void construct(pointer location, Args&&... args);
+
+    /// ----------------------------------------------------------------------
+    /// @function check_room
+    /// @param    count    holds the number of elements that will be added
+    /// @note Reports an overflow through OverflowPolicy if 'count' more
+    /// elements don't fit.
+    /// ----------------------------------------------------------------------
+
+    constexpr void check_room(size_type count) const
+    {
+        if (count > N - m_size)
+        {
+            OverflowPolicy::overflow("Capacity of the StaticArrayList exceeded!");
+        }
+    }
+
+    detail::StaticStorage<T, N> m_storage;  ///< Inline element storage.
+    size_type m_size = 0;                   ///< The number of elements in use.
+};  // StaticArrayList class
+
+//! *********************** Operator Overloads *********************** !//
+
+/// ----------------------------------------------------------------------
+/// @function operator==    </! Equality Comparison Operator !/>
+/// @param    lhs        -Left-hand side static array
+/// @param    rhs        -Right-hand side static array
+/// @return   Returns true if lhs 'does' compare equal to rhs, else false.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr bool operator==(const StaticArrayList<T, N, OverflowPolicy>& lhs,
+                          const StaticArrayList<T, N, OverflowPolicy>& rhs);
+
+/// ----------------------------------------------------------------------
+/// @function operator!=    </! Inequality Comparison Operator !/>
+/// @param    lhs        -Left-hand side static array
+/// @param    rhs        -Right-hand side static array
+/// @return   Returns true if lhs is not equal to rhs, else false.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr bool operator!=(const StaticArrayList<T, N, OverflowPolicy>& lhs,
+                          const StaticArrayList<T, N, OverflowPolicy>& rhs);
+
+/// ----------------------------------------------------------------------
+/// @function operator<<  </! Stream Insertion Operator !/>
+/// @param    output      Output stream where data is sent
+/// @param    list        Object of the class
+/// @return   Allows objects to be formatted and sent to output streams.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+std::ostream& operator<<(std::ostream& output, const StaticArrayList<T, N, OverflowPolicy>& list);
+
+// =======================================================================
+//                      D E F I N I T I O N S
+// =======================================================================
+
+/// ----------------------------------------------------------------------
+/// @function StaticArrayList
+/// @param count    holds the number of elements to construct
+/// @note Constructs a StaticArrayList with count copies of the default
+/// value of value_type. A count greater than N is an overflow.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr StaticArrayList<T, N, OverflowPolicy>::StaticArrayList(size_type count)
+: StaticArrayList()
+{
+    resize(count);
+}
+
+/// ----------------------------------------------------------------------
+/// @function StaticArrayList
+/// @param    source   Holds initializer list of elements
+/// @note     Constructs a container with a copy of the source elements.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr StaticArrayList<T, N, OverflowPolicy>::StaticArrayList(std::initializer_list<value_type> source)
+: StaticArrayList()
+{
+    check_room(source.size());
+
+    for (const auto& item : source)
+    {
+        construct(data() + m_size, item);
+        ++m_size;
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function StaticArrayList  </! Copy Constructor !/>
+/// @param    other    holds a reference to other StaticArrayList
+/// @note     Copies other's elements.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr StaticArrayList<T, N, OverflowPolicy>::StaticArrayList(const StaticArrayList& other)
+: StaticArrayList()
+{
+    for (const auto& item : other)
+    {
+        construct(data() + m_size, item);
+        ++m_size;
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function StaticArrayList  </! Move Constructor !/>
+/// @param    other     holds the state of another object being moved
+/// @note Moves other's elements one by one, leaving other empty.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr StaticArrayList<T, N, OverflowPolicy>::StaticArrayList(StaticArrayList&& other)
+noexcept(std::is_nothrow_move_constructible_v<T>)
+: StaticArrayList()
+{
+    for (auto& item : other)
+    {
+        construct(data() + m_size, std::move(item));
+        ++m_size;
+    }
+    other.clear();
+}
+
+/// ----------------------------------------------------------------------
+/// @function at
+/// @param    pos     Zero-based index of the element to access
+/// @return   Returns a reference to an element at the specified position.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr typename StaticArrayList<T, N, OverflowPolicy>::reference
+StaticArrayList<T, N, OverflowPolicy>::at(size_type pos)
+{
+    if (pos >= size())
+    {
+        throw std::out_of_range{ "Accessed position is out of range!" };
+    }
+
+    return *(data() + pos);
+}
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr typename StaticArrayList<T, N, OverflowPolicy>::const_reference
+StaticArrayList<T, N, OverflowPolicy>::at(size_type pos) const
+{
+    if (pos >= size())
+    {
+        throw std::out_of_range{ "Accessed position is out of range!" };
+    }
+
+    return *(data() + pos);
+}
+
+/// ----------------------------------------------------------------------
+/// @function front
+///
+/// @return Returns a reference to the first element in the container.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr typename StaticArrayList<T, N, OverflowPolicy>::reference
+StaticArrayList<T, N, OverflowPolicy>::front()
+{
+    if (empty())
+    {
+        throw std::out_of_range{ "Accessed position is out of range!" };
+    }
+    return *data();
+}
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr typename StaticArrayList<T, N, OverflowPolicy>::const_reference
+StaticArrayList<T, N, OverflowPolicy>::front() const
+{
+    if (empty())
+    {
+        throw std::out_of_range{ "Accessed position is out of range!" };
+    }
+    return *data();
+}
+
+/// ----------------------------------------------------------------------
+/// @function clear
+///
+/// @note Destroys every element and resets the size of the container to 0.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr void StaticArrayList<T, N, OverflowPolicy>::clear() noexcept
+{
+    if constexpr (!trivial_storage)
+    {
+        std::destroy(data(), data() + m_size);
+    }
+    m_size = 0;
+}
+
+/// ----------------------------------------------------------------------
+/// @function push_back
+///
+/// @param    value    holds the 'value' to append
+/// @note Appends the given element value to the end of the container.
+/// Appending to a full container is an overflow.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr void StaticArrayList<T, N, OverflowPolicy>::push_back(const value_type& value)
+{
+    emplace_back(value);
+}
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr void StaticArrayList<T, N, OverflowPolicy>::push_back(value_type&& value)
+{
+    emplace_back(std::move(value));
+}
+
+/// ----------------------------------------------------------------------
+/// @function try_push_back
+///
+/// @param    value    holds the 'value' to append
+/// @return   Returns 'True' if value was appended, or 'False' without
+///           touching the container when it is full.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr bool StaticArrayList<T, N, OverflowPolicy>::try_push_back(const value_type& value)
+{
+    return try_emplace_back(value);
+}
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr bool StaticArrayList<T, N, OverflowPolicy>::try_push_back(value_type&& value)
+{
+    return try_emplace_back(std::move(value));
+}
+
+/// ----------------------------------------------------------------------
+/// @function emplace_back
+/// @param    args     holds the arguments forwarded to the constructor
+/// @return   Returns a reference to the new element.
+/// @note Constructs a new element in place at the end of the container.
+/// Appending to a full container is an overflow.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+template <class... Args>
+constexpr typename StaticArrayList<T, N, OverflowPolicy>::reference
+StaticArrayList<T, N, OverflowPolicy>::emplace_back(Args&&... args)
+{
+    check_room(1);
+
+    construct(data() + m_size, std::forward<Args>(args)...);
+    ++m_size;
+
+    return back();
+}
+
+/// ----------------------------------------------------------------------
+/// @function try_emplace_back
+/// @param    args     holds the arguments forwarded to the constructor
+/// @return   Returns 'True' if the element was constructed, or 'False'
+///           without touching the container when it is full.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+template <class... Args>
+constexpr bool StaticArrayList<T, N, OverflowPolicy>::try_emplace_back(Args&&... args)
+{
+    if (full())
+    {
+        return false;
+    }
+
+    construct(data() + m_size, std::forward<Args>(args)...);
+    ++m_size;
+
+    return true;
+}
+
+/// ----------------------------------------------------------------------
+/// @function pop_back
+///
+/// @note Destroys the last element of the container.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr void StaticArrayList<T, N, OverflowPolicy>::pop_back()
+{
+    if (empty())
+    {
+        throw std::out_of_range{ "Accessed position is out of range!" };
+    }
+
+    --m_size;
+
+    if constexpr (!trivial_storage)
+    {
+        std::destroy_at(data() + m_size);
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function insert
+/// @param    pos        holds the position to be inserted to
+/// @param    value    holds the new element to be inserted
+/// @return   Returns an iterator pointing to the newly inserted element.
+/// @note     Inserts the new element 'value', at the iterator 'pos'.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr typename StaticArrayList<T, N, OverflowPolicy>::iterator
+StaticArrayList<T, N, OverflowPolicy>::insert(const_iterator pos, const value_type& value)
+{
+    return emplace(pos, value);
+}
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr typename StaticArrayList<T, N, OverflowPolicy>::iterator
+StaticArrayList<T, N, OverflowPolicy>::insert(const_iterator pos, value_type&& value)
+{
+    return emplace(pos, std::move(value));
+}
+
+/// ----------------------------------------------------------------------
+/// @function emplace
+/// @param    pos      holds the position to be inserted to
+/// @param    args     holds the arguments forwarded to the constructor
+/// @return   Returns an iterator pointing to the new element.
+/// @note     Constructs a new element in place, at the iterator 'pos'.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+template <class... Args>
+constexpr typename StaticArrayList<T, N, OverflowPolicy>::iterator
+StaticArrayList<T, N, OverflowPolicy>::emplace(const_iterator pos, Args&&... args)
+{
+    if (pos < begin() || pos > end())
+    {
+        throw std::out_of_range{ "Accessed position is out of range!" };
+    }
+
+    check_room(1);
+
+    const auto offset = static_cast<size_type>(pos - begin());
+
+    if (offset == size())
+    {
+        construct(data() + m_size, std::forward<Args>(args)...);
+        ++m_size;
+        return data() + offset;
+    }
+
+    // the arguments may refer to an element that is about to be shifted
+    value_type temp(std::forward<Args>(args)...);
+
+    // the last element is moved into the unused slot,
+    // the rest are shifted one to the right over live elements
+    construct(data() + m_size, std::move(*(data() + m_size - 1)));
+    ++m_size;
+    std::move_backward(data() + offset, data() + m_size - 2, data() + m_size - 1);
+
+    // insert new value
+    *(data() + offset) = std::move(temp);
+
+    return data() + offset;
+}
+
+/// ----------------------------------------------------------------------
+/// @function erase
+/// @param    pos  holds the position to be erased
+/// @return   Returns an iterator pointing to the element immediately
+///           following the erased element.
+/// @note Removes the element at the position indicated by the iterator.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr typename StaticArrayList<T, N, OverflowPolicy>::iterator
+StaticArrayList<T, N, OverflowPolicy>::erase(const_iterator pos)
+{
+    if (pos < begin() || pos >= end())
+    {
+        throw std::out_of_range{ "Accessed position is out of range!" };
+    }
+
+    const auto offset = static_cast<size_type>(pos - begin());
+
+    // shuffle elements right of pos to the left
+    std::move(data() + offset + 1, data() + m_size, data() + offset);
+    pop_back();
+
+    return data() + offset;
+}
+
+/// ----------------------------------------------------------------------
+/// @function resize
+/// @param    count    holds the new size of the desired container
+/// @note Resizes the container to the specified 'count', destroying or
+/// default-constructing elements at the end. A count greater than N is
+/// an overflow.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr void StaticArrayList<T, N, OverflowPolicy>::resize(size_type count)
+{
+    if (count < size())
+    {
+        while (size() > count)
+        {
+            pop_back();
+        }
+    }
+    else if (count > size())
+    {
+        check_room(count - size());
+
+        while (size() < count)
+        {
+            construct(data() + m_size);
+            ++m_size;
+        }
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function swap
+/// @param    other   holds a reference to other contianer
+/// @note Exchanges the contents of the container with those of another,
+/// element by element.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr void StaticArrayList<T, N, OverflowPolicy>::swap(StaticArrayList& other)
+{
+    StaticArrayList& shorter = size() < other.size() ? *this : other;
+    StaticArrayList& longer  = size() < other.size() ? other : *this;
+
+    const size_type common = shorter.size();
+
+    std::swap_ranges(shorter.begin(), shorter.end(), longer.begin());
+
+    // move the extra elements across
+    for (size_type index = common; index < longer.size(); ++index)
+    {
+        shorter.construct(shorter.data() + index, std::move(longer[index]));
+        ++shorter.m_size;
+    }
+
+    while (longer.size() > common)
+    {
+        longer.pop_back();
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function operator=   </Copy Assignment Operator/>
+/// @param    rhs          holds contents of other container
+/// @return  Replaces the contents of the container
+///          with a copy of the contents of rhs
+/// @return *this
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr StaticArrayList<T, N, OverflowPolicy>&
+StaticArrayList<T, N, OverflowPolicy>::operator=(const StaticArrayList& rhs)
+{
+    if (this != &rhs) {                         // checks for self-assignment
+        const size_type common = std::min(size(), rhs.size());
+
+        // assign over the live elements, then construct or destroy the rest
+        std::copy(rhs.data(), rhs.data() + common, data());
+
+        while (size() > rhs.size())
+        {
+            pop_back();
+        }
+        while (size() < rhs.size())
+        {
+            construct(data() + m_size, rhs[m_size]);
+            ++m_size;
+        }
+    }
+    return *this;
+}
+
+/// ----------------------------------------------------------------------
+/// @function operator=  </Move Assignment Operator/>
+/// @param    other     holds contents of source container
+/// @return   Replaces the contents of the container with other's
+///           elements, moved one by one, leaving other empty.
+/// @return *this
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr StaticArrayList<T, N, OverflowPolicy>&
+StaticArrayList<T, N, OverflowPolicy>::operator=(StaticArrayList&& other)
+{
+    if (this != &other) {                       // checks for self-assignment
+        const size_type common = std::min(size(), other.size());
+
+        std::move(other.data(), other.data() + common, data());
+
+        while (size() > other.size())
+        {
+            pop_back();
+        }
+        while (size() < other.size())
+        {
+            construct(data() + m_size, std::move(other[m_size]));
+            ++m_size;
+        }
+        other.clear();
+    }
+    return *this;
+}
+
+/// ----------------------------------------------------------------------
+/// @function operator+=
+/// @param other    holds other contents to be appended
+/// @return Appends the contents of other to the contianer. If they don't
+///         all fit, it is an overflow and nothing is appended.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr StaticArrayList<T, N, OverflowPolicy>&
+StaticArrayList<T, N, OverflowPolicy>::operator+=(const StaticArrayList& other)
+{
+    check_room(other.size());
+
+    // reading other's size up front keeps 'list += list' well-defined
+    const size_type count = other.size();
+
+    for (size_type index = 0; index < count; ++index)
+    {
+        construct(data() + m_size, other[index]);
+        ++m_size;
+    }
+    return *this;
+}
+
+/// ----------------------------------------------------------------------
+/// @function construct
+/// @param    location    holds the slot to construct in
+/// @param    args        holds the arguments forwarded to the constructor
+/// @note Constructs an element in an unused slot. During constant
+/// evaluation the live trivial slot is assigned instead.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+template <class... Args>
+constexpr void StaticArrayList<T, N, OverflowPolicy>::construct(pointer location, Args&&... args)
+{
+    if constexpr (trivial_storage && std::is_move_assignable_v<value_type>)
+    {
+        if (std::is_constant_evaluated())
+        {
+            *location = value_type(std::forward<Args>(args)...);
+            return;
+        }
+    }
+    std::construct_at(location, std::forward<Args>(args)...);
+}
+
+/// ----------------------------------------------------------------------
+/// @function operator==  </! Equality Comparison Operator !/>
+/// @param    lhs         -Left-hand side static array
+/// @param    rhs         -Right-hand side static array
+/// @return   Returns true if lhs 'does' compare equal to rhs, else false.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr bool operator==(const StaticArrayList<T, N, OverflowPolicy>& lhs,
+                          const StaticArrayList<T, N, OverflowPolicy>& rhs)
+{
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+/// ----------------------------------------------------------------------
+/// @function operator!=    </! Inequality Comparison Operator !/>
+/// @param    lhs        -Left-hand side static array
+/// @param    rhs        -Right-hand side static array
+/// @return   Returns true if lhs is not equal to rhs, else false.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+constexpr bool operator!=(const StaticArrayList<T, N, OverflowPolicy>& lhs,
+                          const StaticArrayList<T, N, OverflowPolicy>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+/// ----------------------------------------------------------------------
+/// @function operator<<  </! Stream Insertion Operator !/>
+/// @param    output      Output stream where data is sent
+/// @param    list        Object of the class
+/// @return   Allows objects to be formatted and sent to output streams.
+/// ----------------------------------------------------------------------
+
+template <class T, std::size_t N, class OverflowPolicy>
+std::ostream& operator<<(std::ostream& output, const StaticArrayList<T, N, OverflowPolicy>& list)
+{
+    char separator[2]{};
+
+    output << '{';
+
+    for (const auto& item : list) {
+        output << separator << item;
+        *separator = ',';
+    }
+
+    return output << '}';
+}
+
+// ----------------------------------------------------------------------
+
+} // namespace AL
+
+#endif /* StaticArrayList_hpp */
+
+/* EOF */
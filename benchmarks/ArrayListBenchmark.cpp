@@ -0,0 +1,546 @@
+/// @author - Brandon Wallace
+/// @file - ArrayListBenchmark.cpp
+/// @brief - Times the ArrayList hot paths against std::vector for several
+/// element types and sizes, and writes the results as JSON.
+///
+/// Build and run from the repository root, e.g.
+///
+///     g++ -std=c++20 -O2 -DNDEBUG -I. benchmarks/ArrayListBenchmark.cpp -o bench
+///     ./bench --max-size=100000000 --min-time=0.2 --out=results.json
+///
+/// Options:
+///     --max-size=N    largest container size to run (default 1048576)
+///     --min-time=S    minimum seconds spent timing each case (default 0.1)
+///     --filter=TEXT   only run cases whose name contains TEXT
+///     --out=FILE      write the JSON there instead of stdout
+
+/// C++ Standard Library Header Files
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "ArrayList.hpp"
+
+namespace {
+
+//! ************************* Element Types ************************** !//
+
+/// ----------------------------------------------------------------------
+/// @struct   Pod64
+/// @note 64-byte trivially copyable element.
+/// ----------------------------------------------------------------------
+
+struct Pod64 {
+    std::array<std::uint64_t, 8> fields{};
+
+    friend bool operator==(const Pod64& lhs, const Pod64& rhs) { return lhs.fields == rhs.fields; }
+};
+
+static_assert(sizeof(Pod64) == 64);
+
+/// ----------------------------------------------------------------------
+/// @struct   MoveOnly
+/// @note Move-only element with a non-trivial move constructor, which
+/// the containers can't relocate with memcpy.
+/// ----------------------------------------------------------------------
+
+struct MoveOnly {
+    MoveOnly() = default;
+    explicit MoveOnly(std::size_t value) : m_value(std::make_unique<std::size_t>(value)) {}
+
+    MoveOnly(MoveOnly&&) noexcept = default;
+    MoveOnly& operator=(MoveOnly&&) noexcept = default;
+
+    std::unique_ptr<std::size_t> m_value;
+};
+
+/// ----------------------------------------------------------------------
+/// @function make_element
+/// @param    index    holds the position of the element being built
+/// @return   Returns an element whose contents depend on 'index'.
+/// @note Strings are longer than the small-string buffer, so every one
+/// owns heap memory.
+/// ----------------------------------------------------------------------
+
+template <class T>
+T make_element(std::size_t index)
+{
+    if constexpr (std::is_same_v<T, int>)
+    {
+        return static_cast<int>(index);
+    }
+    else if constexpr (std::is_same_v<T, Pod64>)
+    {
+        Pod64 pod;
+        pod.fields[0] = index;
+        return pod;
+    }
+    else if constexpr (std::is_same_v<T, std::string>)
+    {
+        return std::string(32, static_cast<char>('a' + index % 26));
+    }
+    else
+    {
+        return MoveOnly(index);
+    }
+}
+
+/// ----------------------------------------------------------------------
+/// @function weight
+/// @param    value    holds the element to read
+/// @return   Returns a number derived from the element, read by 'iterate'.
+/// ----------------------------------------------------------------------
+
+std::size_t weight(int value) { return static_cast<std::size_t>(value); }
+std::size_t weight(const Pod64& value) { return value.fields[0]; }
+std::size_t weight(const std::string& value) { return value.size(); }
+std::size_t weight(const MoveOnly& value) { return value.m_value ? *value.m_value : 0; }
+
+template <class T> constexpr const char* element_name();
+template <> constexpr const char* element_name<int>()         { return "int"; }
+template <> constexpr const char* element_name<Pod64>()       { return "pod64"; }
+template <> constexpr const char* element_name<std::string>() { return "string"; }
+template <> constexpr const char* element_name<MoveOnly>()    { return "move_only"; }
+
+//! ************************ Container Shims ************************* !//
+
+template <class T>
+struct ContainerName;
+
+template <class T>
+struct ContainerName<std::vector<T>> { static constexpr const char* value = "std::vector"; };
+
+template <class T>
+struct ContainerName<AL::ArrayList<T>> { static constexpr const char* value = "AL::ArrayList"; };
+
+/// ----------------------------------------------------------------------
+/// @function append
+/// @param    lhs    holds the container appended to
+/// @param    rhs    holds the elements to append
+/// @note operator+= for ArrayList, the equivalent range insert for vector.
+/// ----------------------------------------------------------------------
+
+template <class T>
+void append(std::vector<T>& lhs, const std::vector<T>& rhs) { lhs.insert(lhs.end(), rhs.begin(), rhs.end()); }
+
+template <class T>
+void append(AL::ArrayList<T>& lhs, const AL::ArrayList<T>& rhs) { lhs += rhs; }
+
+/// ----------------------------------------------------------------------
+/// @function do_not_optimize
+/// @param    value    holds an object whose computation must not be removed
+/// ----------------------------------------------------------------------
+
+template <class T>
+void do_not_optimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+template <class Container>
+Container make_filled(std::size_t size)
+{
+    Container list;
+    list.reserve(size);
+
+    for (std::size_t index = 0; index < size; ++index)
+    {
+        list.push_back(make_element<typename Container::value_type>(index));
+    }
+    return list;
+}
+
+//! ************************** Measurement *************************** !//
+
+struct Options {
+    std::size_t max_size = std::size_t{ 1 } << 20;
+    double      min_time = 0.1;
+    std::string filter;
+    std::string out;
+};
+
+struct Result {
+    std::string name;
+    std::string container;
+    std::string element;
+    std::string operation;
+    std::size_t size;
+    std::size_t iterations;
+    double      ns_per_iteration;
+    std::size_t items_per_iteration;
+};
+
+/// Elements kept alive across a batch of prepared states.
+constexpr std::size_t batch_element_budget = std::size_t{ 1 } << 22;
+
+/// Wall-clock limit of a case, as a multiple of the minimum time.
+constexpr double setup_time_factor = 10.0;
+
+/// Insertions or erasures timed per iteration of the positional cases.
+constexpr std::size_t positional_ops = 16;
+
+/// ----------------------------------------------------------------------
+/// @function measure
+/// @param    setup    holds a callable returning a fresh state, not timed
+/// @param    op       holds the callable being timed on each state
+/// @param    size     holds the container size, used to size the batches
+/// @param    options  holds the minimum time to spend
+/// @return   Returns { iterations, nanoseconds per iteration }.
+/// @note States are prepared in batches ahead of the clock, and destroyed
+/// after it stops, so only 'op' is measured. Cases whose setup dwarfs the
+/// operation stop after setup_time_factor times the minimum time, counted
+/// from the end of the warm-up, but always time at least one batch.
+/// ----------------------------------------------------------------------
+
+template <class Setup, class Op>
+std::pair<std::size_t, double> measure(Setup setup, Op op, std::size_t size, const Options& options)
+{
+    using clock = std::chrono::steady_clock;
+    using State = decltype(setup());
+
+    const std::size_t max_batch = std::max<std::size_t>(1, batch_element_budget / std::max<std::size_t>(1, size));
+
+    std::size_t batch        = 1;
+    std::size_t iterations   = 0;
+    clock::duration elapsed{};
+
+    // one untimed pass warms the caches and the allocator
+    {
+        State warm = setup();
+        op(warm);
+    }
+
+    // the deadline starts after the warm-up, and one batch always runs
+    const auto deadline = clock::now() +
+        std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(options.min_time * setup_time_factor));
+
+    do
+    {
+        std::vector<std::optional<State>> states(batch);
+
+        for (auto& state : states)
+        {
+            state.emplace(setup());
+        }
+
+        const auto start = clock::now();
+
+        for (auto& state : states)
+        {
+            op(*state);
+        }
+
+        elapsed    += clock::now() - start;
+        iterations += batch;
+        batch       = std::min(batch * 2, max_batch);
+    }
+    while (std::chrono::duration<double>(elapsed).count() < options.min_time && clock::now() < deadline);
+
+    const double ns = std::chrono::duration<double, std::nano>(elapsed).count();
+    return { iterations, ns / static_cast<double>(iterations) };
+}
+
+//! ***************************** Suite ****************************** !//
+
+/// ----------------------------------------------------------------------
+/// @function run_suite
+/// @param    size     holds the number of elements in the container
+/// @param    options  holds the run options
+/// @param    results  holds the results appended to
+/// @note Runs every operation on one container and element type. Copying
+/// operations are skipped for move-only elements.
+/// ----------------------------------------------------------------------
+
+template <class Container>
+void run_suite(std::size_t size, const Options& options, std::vector<Result>& results)
+{
+    using T = typename Container::value_type;
+
+    constexpr bool copyable = std::is_copy_constructible_v<T>;
+
+    const std::string prefix = std::string(ContainerName<Container>::value) + "/" + element_name<T>() + "/";
+
+    auto run = [&](const char* operation, std::size_t items, auto setup, auto op) {
+        const std::string name = prefix + operation + "/" + std::to_string(size);
+
+        if (!options.filter.empty() && name.find(options.filter) == std::string::npos)
+        {
+            return;
+        }
+
+        const auto [iterations, ns] = measure(setup, op, size, options);
+
+        results.push_back({ name, ContainerName<Container>::value, element_name<T>(), operation,
+                            size, iterations, ns, items });
+        std::cerr << name << ": " << ns << " ns\n";
+    };
+
+    // source shared by the read-only cases
+    const Container source = make_filled<Container>(size);
+
+    run("push_back", size,
+        [] { return Container{}; },
+        [size](Container& list) {
+            for (std::size_t index = 0; index < size; ++index)
+            {
+                list.push_back(make_element<T>(index));
+            }
+            do_not_optimize(list);
+        });
+
+    run("insert_front", positional_ops,
+        [size] { return make_filled<Container>(size); },
+        [](Container& list) {
+            for (std::size_t index = 0; index < positional_ops; ++index)
+            {
+                list.insert(list.begin(), make_element<T>(index));
+            }
+            do_not_optimize(list);
+        });
+
+    run("insert_middle", positional_ops,
+        [size] { return make_filled<Container>(size); },
+        [](Container& list) {
+            for (std::size_t index = 0; index < positional_ops; ++index)
+            {
+                list.insert(list.begin() + static_cast<std::ptrdiff_t>(list.size() / 2), make_element<T>(index));
+            }
+            do_not_optimize(list);
+        });
+
+    const std::size_t erasures = std::min(size, positional_ops);
+
+    run("erase_front", erasures,
+        [size] { return make_filled<Container>(size); },
+        [erasures](Container& list) {
+            for (std::size_t index = 0; index < erasures; ++index)
+            {
+                list.erase(list.begin());
+            }
+            do_not_optimize(list);
+        });
+
+    run("erase_middle", erasures,
+        [size] { return make_filled<Container>(size); },
+        [erasures](Container& list) {
+            for (std::size_t index = 0; index < erasures; ++index)
+            {
+                list.erase(list.begin() + static_cast<std::ptrdiff_t>(list.size() / 2));
+            }
+            do_not_optimize(list);
+        });
+
+    run("resize", size,
+        [] { return Container{}; },
+        [size](Container& list) {
+            list.resize(size);
+            do_not_optimize(list);
+        });
+
+    run("move_construct", 1,
+        [size] { return std::pair<Container, std::optional<Container>>(make_filled<Container>(size), std::nullopt); },
+        [](auto& state) {
+            state.second.emplace(std::move(state.first));
+            do_not_optimize(*state.second);
+        });
+
+    run("iterate", size,
+        [] { return 0; },
+        [&source](int&) {
+            std::size_t sum = 0;
+
+            for (const auto& item : source)
+            {
+                sum += weight(item);
+            }
+            do_not_optimize(sum);
+        });
+
+    if constexpr (copyable)
+    {
+        run("copy_construct", size,
+            [] { return std::optional<Container>(); },
+            [&source](std::optional<Container>& copy) {
+                copy.emplace(source);
+                do_not_optimize(*copy);
+            });
+
+        run("append", size,
+            [size] { return make_filled<Container>(size); },
+            [&source](Container& list) {
+                append(list, source);
+                do_not_optimize(list);
+            });
+
+        const Container same = source;
+
+        run("equal", size,
+            [] { return 0; },
+            [&source, &same](int&) {
+                const bool equal = source == same;
+                do_not_optimize(equal);
+            });
+    }
+}
+
+template <class T>
+void run_element(std::size_t size, const Options& options, std::vector<Result>& results)
+{
+    run_suite<std::vector<T>>(size, options, results);
+    run_suite<AL::ArrayList<T>>(size, options, results);
+}
+
+//! ***************************** Output ***************************** !//
+
+std::string json_escape(std::string_view text)
+{
+    std::string escaped;
+
+    for (const char c : text)
+    {
+        if (c == '"' || c == '\\')
+        {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+
+void write_json(std::ostream& output, const Options& options, const std::vector<Result>& results)
+{
+    const std::time_t now = std::time(nullptr);
+    char date[32]{};
+    std::strftime(date, sizeof date, "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+    output << "{\n"
+           << "  \"context\": {\n"
+           << "    \"date\": \"" << date << "\",\n"
+#if defined(__VERSION__)
+           << "    \"compiler\": \"" << json_escape(__VERSION__) << "\",\n"
+#endif
+#if defined(NDEBUG)
+           << "    \"build_type\": \"release\",\n"
+#else
+           << "    \"build_type\": \"debug\",\n"
+#endif
+           << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+           << "    \"min_time_s\": " << options.min_time << ",\n"
+           << "    \"time_unit\": \"ns\"\n"
+           << "  },\n"
+           << "  \"benchmarks\": [";
+
+    const char* separator = "\n";
+
+    for (const auto& result : results)
+    {
+        output << separator
+               << "    {\"name\": \"" << json_escape(result.name) << "\""
+               << ", \"container\": \"" << result.container << "\""
+               << ", \"element\": \"" << result.element << "\""
+               << ", \"operation\": \"" << result.operation << "\""
+               << ", \"size\": " << result.size
+               << ", \"iterations\": " << result.iterations
+               << ", \"real_time\": " << result.ns_per_iteration
+               << ", \"items_per_iteration\": " << result.items_per_iteration
+               << "}";
+        separator = ",\n";
+    }
+
+    output << "\n  ]\n}\n";
+}
+
+bool parse_options(int argc, char* argv[], Options& options)
+{
+    for (int index = 1; index < argc; ++index)
+    {
+        const std::string_view arg = argv[index];
+        const auto value = [&](std::string_view flag) { return std::string(arg.substr(flag.size())); };
+
+        if (arg.starts_with("--max-size="))
+        {
+            options.max_size = std::stoull(value("--max-size="));
+        }
+        else if (arg.starts_with("--min-time="))
+        {
+            options.min_time = std::stod(value("--min-time="));
+        }
+        else if (arg.starts_with("--filter="))
+        {
+            options.filter = value("--filter=");
+        }
+        else if (arg.starts_with("--out="))
+        {
+            options.out = value("--out=");
+        }
+        else
+        {
+            std::cerr << "unknown option: " << arg << '\n';
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    Options options;
+
+    if (!parse_options(argc, argv, options))
+    {
+        return EXIT_FAILURE;
+    }
+
+    // 16 to 16M in steps of 16x, then 100M
+    std::vector<std::size_t> sizes;
+
+    for (std::size_t size = 16; size <= std::min<std::size_t>(options.max_size, std::size_t{ 1 } << 24); size *= 16)
+    {
+        sizes.push_back(size);
+    }
+    if (options.max_size >= 100'000'000)
+    {
+        sizes.push_back(100'000'000);
+    }
+
+    std::vector<Result> results;
+
+    for (const std::size_t size : sizes)
+    {
+        run_element<int>(size, options, results);
+        run_element<Pod64>(size, options, results);
+        run_element<std::string>(size, options, results);
+        run_element<MoveOnly>(size, options, results);
+    }
+
+    if (options.out.empty())
+    {
+        write_json(std::cout, options, results);
+    }
+    else
+    {
+        std::ofstream file(options.out);
+        write_json(file, options, results);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/* EOF */